@@ -58,6 +58,20 @@
     /*Size of the memory expand for `lv_malloc()` in bytes*/
     #define LV_MEM_POOL_EXPAND_SIZE 0
 
+    /*Serve the small allocations (<= 64 bytes) from per-size free lists in front of TLSF.
+     *It's faster and keeps the many small objects (event descriptors, style arrays, list nodes)
+     *from fragmenting the heap.*/
+    #define LV_USE_MEM_SLAB 1
+    #if LV_USE_MEM_SLAB
+        /*Size of the slab taken from the heap at init in bytes.
+         *More slab memory (e.g. in a faster RAM) can be added with `lv_mem_add_slab_pool()`. 0: use only the added pools*/
+        #define LV_MEM_SLAB_SIZE (4U * 1024U)      /*[bytes]*/
+    #endif
+
+    /*Enable `lv_mem_arena_begin/end()` to bump-allocate e.g. a whole screen from one block.
+     *The block is returned to the heap in one step when all of its allocations are freed.*/
+    #define LV_USE_MEM_ARENA 1
+
     /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
     #define LV_MEM_ADR 0     /*0: unused*/
     /*Instead of an address give a memory allocator that will be called to get a memory pool for LVGL. E.g. my_malloc*/
@@ -128,11 +142,38 @@
 /*The target buffer size for simple layer chunks.*/
 #define LV_DRAW_LAYER_SIMPLE_BUF_SIZE    (24 * 1024)   /*[bytes]*/
 
+/* Keep the freed draw buffers (layers, glyphs, decoded images) in a pool and reuse them
+ * instead of returning them to the heap on every frame. It reduces the fragmentation of the heap.
+ * The buffers are rounded up to size classes (1/4 steps between powers of 2).
+ * Max. bytes kept in the pool. 0: disable */
+#define LV_DRAW_BUF_POOL_SIZE    LV_DRAW_LAYER_SIMPLE_BUF_SIZE   /*[bytes]*/
+
 /* The stack size of the drawing thread.
  * NOTE: If FreeType or ThorVG is enabled, it is recommended to set it to 32KB or more.
  */
 #define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)   /*[bytes]*/
 
+/* If more areas are invalidated in one refresh period than `LV_INV_BUF_SIZE`
+ * store the rest in a tile map instead of redrawing the whole screen.
+ * Size of a tile in pixels (power of 2). 0: disable the tile map */
+#define LV_REFR_INV_TILE_SIZE    32   /*[px]*/
+
+/* Store a hash of the flushed pixels in segments of this many pixels of each row
+ * and in partial render mode flush only the rows and columns whose segments changed.
+ * Useful for slow (e.g. SPI) displays. Requires `hor_res / LV_REFR_FLUSH_DIFF_SEG_W * ver_res * 4` bytes.
+ * 0: disable */
+#define LV_REFR_FLUSH_DIFF_SEG_W    0   /*[px]*/
+
+/* With more than one draw unit, track which older draw tasks overlap each new draw task
+ * in a grid of cells of this size over the layer, so that independent draw tasks can be found
+ * without comparing them with all the older draw tasks. 0: disable*/
+#define LV_DRAW_TASK_DEP_CELL_SIZE    0   /*[px]*/
+
+/* Collect this many draw tasks of a layer before dispatching them, and drop the fill, border, shadow
+ * and image draw tasks which are fully covered by a later opaque fill or image of the same batch.
+ * The partially covered ones are clipped if a whole side is covered. 0: disable */
+#define LV_DRAW_CULL_TASK_CNT    16
+
 #define LV_USE_DRAW_SW 1
 #if LV_USE_DRAW_SW == 1
 
@@ -158,6 +199,12 @@
      * > 1 means multiple threads will render the screen in parallel */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /* Split large fill, image and layer draw tasks into horizontal bands
+     * which are rendered in parallel by the idle draw units.
+     * Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`.
+     * Minimal size of the draw task to split in pixels. 0: disable */
+    #define LV_DRAW_SW_BAND_SPLIT_MIN_AREA    0
+
     /* Use Arm-2D to accelerate the sw render */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -171,16 +218,24 @@
     #if LV_DRAW_SW_COMPLEX == 1
         /*Allow buffering some shadow calculation.
         *LV_DRAW_SW_SHADOW_CACHE_SIZE is the max. shadow size to buffer, where shadow size is `shadow_width + radius`
-        *Caching has LV_DRAW_SW_SHADOW_CACHE_SIZE^2 RAM cost*/
+        *The corners of several shadows are kept in a cache of LV_DRAW_SW_SHADOW_CACHE_MEM bytes.
+        *A corner takes about LV_DRAW_SW_SHADOW_CACHE_SIZE^2 bytes*/
         #define LV_DRAW_SW_SHADOW_CACHE_SIZE 0
 
-        /* Set number of maximally cached circle data.
-        * The circumference of 1/4 circle are saved for anti-aliasing
-        * radius * 4 bytes are used per circle (the most often used radiuses are saved)
+        /*Size of the shadow cache in bytes. The least recently used corners are dropped when it's full*/
+        #define LV_DRAW_SW_SHADOW_CACHE_MEM (LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE * 4)
+
+        /* Maximal memory in bytes used to cache circle data.
+        * The circumference of 1/4 circle are saved for anti-aliasing of the rounded rectangles, arcs and borders.
+        * About radius * 6 bytes are used per circle. The least recently used radiuses are dropped first.
         * 0: to disable caching */
-        #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
+        #define LV_DRAW_SW_CIRCLE_CACHE_MEM 2048
     #endif
 
+    /* Use optimized blend functions of a CPU architecture:
+     * LV_DRAW_SW_ASM_NONE, LV_DRAW_SW_ASM_NEON, LV_DRAW_SW_ASM_HELIUM, LV_DRAW_SW_ASM_CUSTOM,
+     * LV_DRAW_SW_ASM_SSE2 or LV_DRAW_SW_ASM_AVX2 on x86 (AVX2 needs e.g. `-mavx2`),
+     * LV_DRAW_SW_ASM_VECTOR for any target with GCC vector extensions (GCC 9+ or clang) */
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -369,6 +424,12 @@
  *The main logic is like `LV_CACHE_DEF_SIZE` but for image headers.*/
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/*1: Decode the images of a screen in the background when it's loaded (see `lv_image_prefetch.h`).
+ *With an OS the decoding runs in a thread with `LV_DRAW_THREAD_STACK_SIZE` stack,
+ *else one image is decoded per timer period.
+ *Requires `LV_CACHE_DEF_SIZE > 0` to keep the decoded images.*/
+#define LV_USE_IMAGE_PREFETCH 0
+
 /*Number of stops allowed per gradient. Increase this to allow more stops.
  *This adds (sizeof(lv_color_t) + 1) bytes per additional stop*/
 #define LV_GRADIENT_MAX_STOPS   2
@@ -380,6 +441,24 @@
 /* Add 2 x 32 bit variables to each lv_obj_t to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/* Number of entries in the cache of resolved style properties (obj, part, state, prop -> value).
+ * Must be a power of 2. All entries are invalidated when any style or style selector changes.
+ * An entry takes 20 bytes on 32 bit systems. To be effective it should be about
+ * (number of objects) x (number of style properties they use) large.
+ * 0: to disable*/
+#define LV_OBJ_STYLE_RES_CACHE_SIZE     0
+
+/* 1: Step the animations in two passes. First the values of all animations using the built-in
+ * linear or ease paths are calculated together in a tight loop, then the exec callbacks are called.
+ * The `start_cb`s of the animations are called before any exec callbacks of the same step.*/
+#define LV_ANIM_BATCH_STEP      0
+
+/* Index the children of the objects having at least this many children in a grid
+ * to find the pressed object faster. It helps on screens with many objects (e.g. a table of buttons).
+ * The indices are rebuilt on the next press after any object was moved, resized or reordered.
+ * 0: disable*/
+#define LV_OBJ_HIT_INDEX_MIN_CHILD  32
+
 /* Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -529,6 +608,18 @@
 /*Enables/disables support for compressed fonts.*/
 #define LV_USE_FONT_COMPRESSED 0
 
+/*Number of entries in the caches of glyph IDs and kerning values of the built-in font format.
+ *Speeds up the lookups in fonts with many sparse code point ranges or kerning pairs (e.g. CJK fonts).
+ *Must be a power of 2. The caches are not thread safe so they are used only with LV_OS_NONE.
+ *0: to disable*/
+#define LV_FONT_FMT_TXT_CACHE_SIZE 64
+
+/*Size of the cache of rendered glyph bitmaps in bytes.
+ *Fonts using the built-in font format keep their glyphs converted to A8 in this cache,
+ *so repeated text is only blended (and compressed glyphs are not decompressed again).
+ *0: to disable*/
+#define LV_FONT_GLYPH_CACHE_SIZE 0
+
 /*Enable drawing placeholders when glyph dsc is not found*/
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -559,6 +650,11 @@
  *Depends on LV_TXT_LINE_BREAK_LONG_LEN.*/
 #define LV_TXT_LINE_BREAK_LONG_POST_MIN_LEN 3
 
+/*Size of the cache of text layouts (line breaks and line widths) in bytes.
+ *Wrapped texts are broken into lines only once and reused until the text, font, width or flags change.
+ *0: to disable*/
+#define LV_TEXT_LAYOUT_CACHE_SIZE 0
+
 /*Support bidirectional texts. Allows mixing Left-to-Right and Right-to-Left texts.
  *The direction will be processed according to the Unicode Bidirectional Algorithm:
  *https://www.w3.org/International/articles/inline-bidi-markup/uba-basics*/
@@ -89,6 +89,17 @@ void lv_port_disp_init(void)
     // static uint8_t buf_3_2[MY_DISP_HOR_RES * MY_DISP_VER_RES * BYTE_PER_PIXEL];
     // lv_display_set_buffers(disp, buf_3_1, buf_3_2, sizeof(buf_3_1), LV_DISPLAY_RENDER_MODE_DIRECT);
 
+    // /* Example 4
+    //  * A ring of buffers for partial rendering.
+    //  * The next parts are rendered while the previous ones are still being transferred.
+    //  * flush_cb should only start a DMA transfer (queue it if a transfer is in progress) and
+    //  * lv_display_flush_ready() (or lv_display_flush_ready_isr() from an interrupt)
+    //  * has to be called for each transfer in order.*/
+    // LV_ATTRIBUTE_MEM_ALIGN
+    // static uint8_t buf_4[3][MY_DISP_HOR_RES * 10 * BYTE_PER_PIXEL];
+    // void * bufs_4[] = {buf_4[0], buf_4[1], buf_4[2]};
+    // lv_display_set_buffer_ring(disp, bufs_4, 3, sizeof(buf_4[0]));
+
 }
 
 /**********************
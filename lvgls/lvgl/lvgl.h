@@ -45,6 +45,7 @@ extern "C" {
 #include "src/font/lv_font.h"
 #include "src/font/lv_binfont_loader.h"
 #include "src/font/lv_font_fmt_txt.h"
+#include "src/font/lv_font_glyph_cache.h"
 
 #include "src/widgets/animimage/lv_animimage.h"
 #include "src/widgets/arc/lv_arc.h"
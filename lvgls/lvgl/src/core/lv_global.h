@@ -31,9 +31,7 @@ extern "C" {
 #include "../others/sysmon/lv_sysmon.h"
 #include "../stdlib/builtin/lv_tlsf.h"
 
-#if LV_USE_FONT_COMPRESSED
 #include "../font/lv_font_fmt_txt_private.h"
-#endif
 
 #include "../tick/lv_tick.h"
 #include "../layouts/lv_layout.h"
@@ -44,6 +42,7 @@ extern "C" {
 #include "../misc/lv_anim_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
+#include "../draw/lv_image_prefetch_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
@@ -89,6 +88,17 @@ typedef struct lv_global_t {
     uint32_t style_custom_table_size;
     uint32_t style_last_custom_prop_id;
     uint8_t * style_custom_prop_flag_lookup_table;
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    lv_obj_style_res_cache_entry_t * style_res_cache;
+    uint32_t style_res_cache_gen;   /**< Bumped on every style change to invalidate `style_res_cache`*/
+    uint32_t style_res_cache_hit;
+    uint32_t style_res_cache_miss;
+#endif
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+    uint32_t obj_hit_index_gen;     /**< Bumped on every position or order change to invalidate the hit-test indices*/
+    uint32_t obj_hit_index_build_cnt;
+    uint32_t obj_hit_index_search_cnt;
+#endif
 
     lv_ll_t group_ll;
     lv_group_t * group_default;
@@ -106,6 +116,9 @@ typedef struct lv_global_t {
 
     lv_event_t * event_header;
     uint32_t event_last_register_id;
+#if LV_USE_PROFILER
+    uint32_t event_sent_cnt[LV_EVENT_LAST + 1];     /**< Sent events per code. The custom codes are counted at `LV_EVENT_LAST`*/
+#endif
 
     lv_timer_state_t timer_state;
     lv_anim_state_t anim_state;
@@ -115,18 +128,33 @@ typedef struct lv_global_t {
     lv_draw_buf_handlers_t font_draw_buf_handlers;
     lv_draw_buf_handlers_t image_cache_draw_buf_handlers;  /**< Ensure that all assigned draw buffers
                                                             * can be managed by image cache. */
+#if LV_DRAW_BUF_POOL_SIZE
+    lv_draw_buf_pool_t draw_buf_pool;
+#endif
 
     lv_ll_t img_decoder_ll;
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_USE_IMAGE_PREFETCH
+    lv_image_prefetch_t image_prefetch;
+#endif
+
+    lv_cache_t * font_glyph_cache;
+    uint32_t font_glyph_cache_hit;
+    uint32_t font_glyph_cache_miss;
+
+    lv_cache_t * text_layout_cache;
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    lv_draw_sw_shadow_cache_t sw_shadow_cache;
+    lv_cache_t * sw_shadow_cache;
 #endif
 #if LV_DRAW_SW_COMPLEX
-    lv_draw_sw_mask_radius_circle_dsc_arr_t sw_circle_cache;
+    lv_cache_t * sw_circle_cache;
+#endif
+#if LV_DRAW_SW_USE_BAND_SPLIT
+    lv_draw_sw_band_job_t sw_band_job;
 #endif
 
 #if LV_USE_LOG
@@ -188,6 +216,10 @@ typedef struct lv_global_t {
 #if LV_USE_FONT_COMPRESSED
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
+#if LV_FONT_FMT_TXT_USE_CACHE
+    lv_font_fmt_txt_gid_cache_entry_t font_fmt_txt_gid_cache[LV_FONT_FMT_TXT_CACHE_SIZE];
+    lv_font_fmt_txt_kern_cache_entry_t font_fmt_txt_kern_cache[LV_FONT_FMT_TXT_CACHE_SIZE];
+#endif
 
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../misc/lv_event_private.h"
 #include "../misc/lv_area_private.h"
 #include "lv_obj_style_private.h"
@@ -537,6 +538,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         lv_event_remove_all(&obj->spec_attr->event_list);
 
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+        lv_obj_hit_index_delete(obj);
+#endif
+
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_class_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../themes/lv_theme.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -92,6 +93,7 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
             lv_obj_allocate_spec_attr(parent);
         }
 
+        lv_obj_hit_index_invalidate();
         parent->spec_attr->child_cnt++;
         parent->spec_attr->children = lv_realloc(parent->spec_attr->children,
                                                  sizeof(lv_obj_t *) * parent->spec_attr->child_cnt);
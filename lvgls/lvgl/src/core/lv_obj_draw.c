@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_draw_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "lv_obj_style.h"
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
@@ -305,7 +306,10 @@ void lv_obj_refresh_ext_draw_size(lv_obj_t * obj)
         obj->spec_attr->ext_draw_size = s_new;
     }
 
-    if(s_new != s_old) lv_obj_invalidate(obj);
+    if(s_new != s_old) {
+        lv_obj_hit_index_invalidate();
+        lv_obj_invalidate(obj);
+    }
 }
 
 int32_t lv_obj_get_ext_draw_size(const lv_obj_t * obj)
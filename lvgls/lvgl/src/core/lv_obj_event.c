@@ -51,6 +51,10 @@ lv_result_t lv_obj_send_event(lv_obj_t * obj, lv_event_code_t event_code, void *
 
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_USE_PROFILER
+    lv_event_count_sent(event_code);
+#endif
+
     lv_event_t e;
     e.current_target = obj;
     e.original_target = obj;
@@ -0,0 +1,298 @@
+/**
+ * @file lv_obj_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_hit_index_private.h"
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+
+#include "lv_obj_private.h"
+#include "lv_obj_draw_private.h"
+#include "lv_global.h"
+#include "../indev/lv_indev.h"
+#include "../misc/lv_area_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define hit_index_gen LV_GLOBAL_DEFAULT()->obj_hit_index_gen
+#define hit_index_build_cnt LV_GLOBAL_DEFAULT()->obj_hit_index_build_cnt
+#define hit_index_search_cnt LV_GLOBAL_DEFAULT()->obj_hit_index_search_cnt
+
+/*Aim for this many children per cell*/
+#define CHILD_PER_CELL  2
+#define CELL_CNT_MAX    1024
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool index_build(lv_obj_t * obj, lv_obj_hit_index_t * index);
+static void index_free_lists(lv_obj_hit_index_t * index);
+static bool get_reach_area(lv_obj_t * child, lv_area_t * area);
+static void get_cell_range(const lv_obj_hit_index_t * index, const lv_area_t * area, int32_t * col_first,
+                           int32_t * col_last, int32_t * row_first, int32_t * row_last);
+static lv_obj_t * search_linear(lv_obj_t * obj, lv_point_t * point);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_obj_hit_index_search_children(lv_obj_t * obj, lv_point_t * point)
+{
+    /*The child indices are stored on 16 bits*/
+    if(obj->spec_attr->child_cnt > UINT16_MAX) return search_linear(obj, point);
+
+    lv_obj_hit_index_t * index = obj->spec_attr->hit_index;
+    if(index == NULL) {
+        index = lv_malloc_zeroed(sizeof(lv_obj_hit_index_t));
+        if(index == NULL) return search_linear(obj, point);
+        index->seen_gen = hit_index_gen;
+        obj->spec_attr->hit_index = index;
+    }
+
+    if(!index->built || index->gen != hit_index_gen) {
+        /*Something has changed since the last search (e.g. scrolling or an animation is in progress).
+         *Build the index only if the objects are still at the same place.*/
+        if(index->seen_gen != hit_index_gen) {
+            index->seen_gen = hit_index_gen;
+            return search_linear(obj, point);
+        }
+
+        if(!index_build(obj, index)) return search_linear(obj, point);
+    }
+
+    hit_index_search_cnt++;
+
+    lv_obj_t ** children = obj->spec_attr->children;
+    int32_t a = (int32_t)index->always_cnt - 1;
+    int32_t c_first = 0;
+    int32_t c = -1;
+    if(lv_area_is_point_on(&index->bbox, point, 0)) {
+        int32_t col = (point->x - index->bbox.x1) / index->cell_w;
+        int32_t row = (point->y - index->bbox.y1) / index->cell_h;
+        uint32_t cell = row * index->col_cnt + col;
+        c_first = index->cell_start[cell];
+        c = (int32_t)index->cell_start[cell + 1] - 1;
+    }
+
+    /*Merge the cell's and the always checked children to go from the top to the bottom
+     *just like `lv_indev_search_obj()`*/
+    while(a >= 0 || c >= c_first) {
+        uint32_t i;
+        if(c < c_first || (a >= 0 && index->always[a] > index->items[c])) i = index->always[a--];
+        else i = index->items[c--];
+
+        lv_obj_t * found = lv_indev_search_obj(children[i], point);
+        if(found) return found;
+    }
+
+    return NULL;
+}
+
+void lv_obj_hit_index_invalidate(void)
+{
+    hit_index_gen++;
+}
+
+void lv_obj_hit_index_delete(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->hit_index == NULL) return;
+
+    index_free_lists(obj->spec_attr->hit_index);
+    lv_free(obj->spec_attr->hit_index);
+    obj->spec_attr->hit_index = NULL;
+}
+
+void lv_obj_hit_index_get_stat(uint32_t * build, uint32_t * search)
+{
+    if(build) *build = hit_index_build_cnt;
+    if(search) *search = hit_index_search_cnt;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool index_build(lv_obj_t * obj, lv_obj_hit_index_t * index)
+{
+    index_free_lists(index);
+    index->built = false;
+
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    lv_obj_t ** children = obj->spec_attr->children;
+
+    /*Get the bounding box and the number of transformed children*/
+    uint32_t always_cnt = 0;
+    bool first = true;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        lv_area_t reach;
+        if(!get_reach_area(children[i], &reach)) {
+            always_cnt++;
+        }
+        else if(first) {
+            index->bbox = reach;
+            first = false;
+        }
+        else {
+            lv_area_join(&index->bbox, &index->bbox, &reach);
+        }
+    }
+
+    /*Nothing to index. Set an empty grid*/
+    if(first) lv_area_set(&index->bbox, 0, 0, -1, -1);
+
+    /*Make the cells about square*/
+    uint32_t indexed_cnt = child_cnt - always_cnt;
+    uint32_t cell_cnt = LV_CLAMP(1, indexed_cnt / CHILD_PER_CELL, CELL_CNT_MAX);
+    int32_t bbox_w = LV_MAX(lv_area_get_width(&index->bbox), 1);
+    int32_t bbox_h = LV_MAX(lv_area_get_height(&index->bbox), 1);
+    uint64_t col_cnt_sqr = ((uint64_t)cell_cnt * bbox_w) / bbox_h;
+    uint32_t col_cnt = lv_sqrt32((uint32_t)LV_MIN(col_cnt_sqr, UINT32_MAX));
+    col_cnt = LV_CLAMP(1, col_cnt, cell_cnt);
+    col_cnt = LV_MIN(col_cnt, (uint32_t)bbox_w);
+    uint32_t row_cnt = LV_CLAMP(1, cell_cnt / col_cnt, (uint32_t)bbox_h);
+    cell_cnt = col_cnt * row_cnt;
+
+    index->col_cnt = col_cnt;
+    index->row_cnt = row_cnt;
+    index->cell_w = (bbox_w + col_cnt - 1) / col_cnt;
+    index->cell_h = (bbox_h + row_cnt - 1) / row_cnt;
+
+    index->cell_start = lv_malloc_zeroed((cell_cnt + 1) * sizeof(uint32_t));
+    index->always = lv_malloc(always_cnt * sizeof(uint16_t));
+    if(index->cell_start == NULL || index->always == NULL) {
+        index_free_lists(index);
+        return false;
+    }
+
+    /*Count the children in the cells and collect the transformed ones*/
+    uint32_t item_cnt = 0;
+    index->always_cnt = 0;
+    for(i = 0; i < child_cnt; i++) {
+        lv_area_t reach;
+        if(!get_reach_area(children[i], &reach)) {
+            index->always[index->always_cnt] = i;
+            index->always_cnt++;
+            continue;
+        }
+
+        int32_t col_first, col_last, row_first, row_last;
+        get_cell_range(index, &reach, &col_first, &col_last, &row_first, &row_last);
+        int32_t row;
+        int32_t col;
+        for(row = row_first; row <= row_last; row++) {
+            for(col = col_first; col <= col_last; col++) {
+                index->cell_start[row * col_cnt + col]++;
+            }
+        }
+        item_cnt += (col_last - col_first + 1) * (row_last - row_first + 1);
+    }
+
+    index->items = lv_malloc(item_cnt * sizeof(uint16_t));
+    if(index->items == NULL) {
+        index_free_lists(index);
+        return false;
+    }
+
+    /*Make `cell_start` point to the end of the cells then fill them from the end
+     *so that they will point to the start and the indices will be ascending*/
+    uint32_t c;
+    for(c = 1; c < cell_cnt; c++) index->cell_start[c] += index->cell_start[c - 1];
+    index->cell_start[cell_cnt] = item_cnt;
+
+    for(i = child_cnt; i > 0; i--) {
+        lv_area_t reach;
+        if(!get_reach_area(children[i - 1], &reach)) continue;
+
+        int32_t col_first, col_last, row_first, row_last;
+        get_cell_range(index, &reach, &col_first, &col_last, &row_first, &row_last);
+        int32_t row;
+        int32_t col;
+        for(row = row_first; row <= row_last; row++) {
+            for(col = col_first; col <= col_last; col++) {
+                uint32_t cell = row * col_cnt + col;
+                index->cell_start[cell]--;
+                index->items[index->cell_start[cell]] = i - 1;
+            }
+        }
+    }
+
+    index->gen = hit_index_gen;
+    index->seen_gen = hit_index_gen;
+    index->built = true;
+    hit_index_build_cnt++;
+
+    return true;
+}
+
+static void index_free_lists(lv_obj_hit_index_t * index)
+{
+    lv_free(index->always);
+    lv_free(index->cell_start);
+    lv_free(index->items);
+    index->always = NULL;
+    index->cell_start = NULL;
+    index->items = NULL;
+    index->always_cnt = 0;
+    index->built = false;
+}
+
+/**
+ * Get the area where `lv_indev_search_obj()` can find the child or any of its descendants:
+ * the click area (for the child) and the coordinates with the extra draw size (for the descendants).
+ * The flags are ignored to not depend on them.
+ * @param child     pointer to a child
+ * @param area      store the area here
+ * @return          false if the child is transformed so it can't be indexed
+ */
+static bool get_reach_area(lv_obj_t * child, lv_area_t * area)
+{
+    if(lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) return false;
+
+    lv_obj_get_click_area(child, area);
+
+    lv_area_t coords = child->coords;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(child);
+    lv_area_increase(&coords, ext_draw_size, ext_draw_size);
+    lv_area_join(area, area, &coords);
+
+    return true;
+}
+
+static void get_cell_range(const lv_obj_hit_index_t * index, const lv_area_t * area, int32_t * col_first,
+                           int32_t * col_last, int32_t * row_first, int32_t * row_last)
+{
+    *col_first = (area->x1 - index->bbox.x1) / index->cell_w;
+    *col_last = (area->x2 - index->bbox.x1) / index->cell_w;
+    *row_first = (area->y1 - index->bbox.y1) / index->cell_h;
+    *row_last = (area->y2 - index->bbox.y1) / index->cell_h;
+}
+
+static lv_obj_t * search_linear(lv_obj_t * obj, lv_point_t * point)
+{
+    int32_t i;
+    for(i = (int32_t)obj->spec_attr->child_cnt - 1; i >= 0; i--) {
+        lv_obj_t * found = lv_indev_search_obj(obj->spec_attr->children[i], point);
+        if(found) return found;
+    }
+
+    return NULL;
+}
+
+#endif /*LV_OBJ_HIT_INDEX_MIN_CHILD*/
@@ -0,0 +1,250 @@
+/**
+ * @file lv_obj_hit_index_bench.c
+ *
+ * Touch latency benchmark of the hit index.
+ * It's a standalone program which is compiled only if `LV_OBJ_HIT_INDEX_BENCH` is defined.
+ *
+ * Build it on a host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_OBJ_HIT_INDEX_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o hit_bench
+ *
+ * Usage: `./hit_bench [button_cnt]`
+ *
+ * A flex container is filled with buttons. Some of them are hidden, transformed, not clickable,
+ * have an extended click area or a child overflowing the button.
+ * First `lv_indev_search_obj()` is compared with a plain linear search at random points
+ * after scrolling, transforming, reordering and growing the buttons.
+ * After that the time of a search is measured for both.
+ * Build it again with `LV_OBJ_HIT_INDEX_MIN_CHILD 0` to see the latency without the index.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_OBJ_HIT_INDEX_BENCH
+
+#include "../../lvgl.h"
+#include "../lvgl_private.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         1024
+#define VER_RES         600
+#define CHECK_CNT       20000
+#define QUERY_CNT       200000
+#define POINT_CNT       1024
+#define POOL_CNT        ((4 * 1024 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static uint32_t check(lv_obj_t * scr);
+static lv_obj_t * search_linear(lv_obj_t * obj, lv_point_t * point);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint8_t draw_buf[HOR_RES * 10 * 2];
+static lv_point_t points[POINT_CNT];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t btn_cnt = argc > 1 ? atoi(argv[1]) : 1500;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, HOR_RES - 20, VER_RES - 20);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(cont, 2, 0);
+    lv_obj_set_style_pad_gap(cont, 2, 0);
+
+    srand(1);
+    for(i = 0; i < btn_cnt; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_set_size(btn, 30 + rand() % 20, 20 + rand() % 10);
+        switch(rand() % 40) {
+            case 0:
+                lv_obj_set_ext_click_area(btn, 6);
+                break;
+            case 1:
+                lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+                break;
+            case 2:
+                lv_obj_set_style_transform_rotation(btn, 300, 0);
+                break;
+            case 3:
+                lv_obj_remove_flag(btn, LV_OBJ_FLAG_CLICKABLE);
+                break;
+            case 4: {
+                    lv_obj_add_flag(btn, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+                    lv_obj_set_style_shadow_width(btn, 10, 0);
+                    lv_obj_t * child = lv_obj_create(btn);
+                    lv_obj_set_size(child, 10, 10);
+                    lv_obj_set_pos(child, 35, 25);
+                    break;
+                }
+        }
+    }
+
+    /*Its size will be changed only by the flex layout*/
+    lv_obj_t * last_btn = lv_button_create(cont);
+    lv_obj_set_size(last_btn, 30, 20);
+    lv_obj_update_layout(scr);
+
+    uint32_t mismatch = check(scr);
+
+    lv_obj_scroll_by(cont, 0, -200, LV_ANIM_OFF);
+    mismatch += check(scr);
+
+    lv_obj_set_style_transform_rotation(lv_obj_get_child(cont, 7), 100, 0);
+    lv_obj_move_to_index(lv_obj_get_child(cont, 3), btn_cnt / 2);
+    lv_obj_update_layout(scr);
+    mismatch += check(scr);
+
+    lv_obj_scroll_to_view(last_btn, LV_ANIM_OFF);
+    lv_obj_update_layout(scr);
+    mismatch += check(scr);
+
+    /*The last button grows to the end of its row but nothing else moves*/
+    lv_obj_set_flex_grow(last_btn, 1);
+    lv_obj_update_layout(scr);
+    mismatch += check(scr);
+
+    printf("mismatch: %"LV_PRIu32"\n", mismatch);
+
+    for(i = 0; i < POINT_CNT; i++) {
+        points[i].x = rand() % HOR_RES;
+        points[i].y = rand() % VER_RES;
+    }
+
+    /*Use the results to be sure that the searches are not optimized out*/
+    uintptr_t acc = 0;
+    double t_start = now_ms();
+    for(i = 0; i < QUERY_CNT; i++) {
+        lv_point_t p = points[i % POINT_CNT];
+        acc += (uintptr_t)lv_indev_search_obj(scr, &p);
+    }
+    double t_search = now_ms() - t_start;
+
+    t_start = now_ms();
+    for(i = 0; i < QUERY_CNT; i++) {
+        lv_point_t p = points[i % POINT_CNT];
+        acc -= (uintptr_t)search_linear(scr, &p);
+    }
+    double t_linear = now_ms() - t_start;
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+    uint32_t build_cnt;
+    uint32_t search_cnt;
+    lv_obj_hit_index_get_stat(&build_cnt, &search_cnt);
+    printf("index builds: %"LV_PRIu32", indexed searches: %"LV_PRIu32"\n", build_cnt, search_cnt);
+#endif
+
+    printf("search: %.3f us/query, linear: %.3f us/query%s\n", t_search * 1e3 / QUERY_CNT,
+           t_linear * 1e3 / QUERY_CNT, acc ? " (different results)" : "");
+
+    return mismatch ? 1 : 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Compare `lv_indev_search_obj()` with the linear search at random points
+ * @param scr   the screen to search on
+ * @return      number of points where the results are different
+ */
+static uint32_t check(lv_obj_t * scr)
+{
+    uint32_t mismatch = 0;
+    uint32_t i;
+    for(i = 0; i < CHECK_CNT; i++) {
+        /*Test the points around the screen too*/
+        lv_point_t p1 = {rand() % (HOR_RES + 40) - 20, rand() % (VER_RES + 40) - 20};
+        lv_point_t p2 = p1;
+        if(lv_indev_search_obj(scr, &p1) != search_linear(scr, &p2)) mismatch++;
+    }
+
+    return mismatch;
+}
+
+/**
+ * The same as `lv_indev_search_obj()` but always checks all the children
+ */
+static lv_obj_t * search_linear(lv_obj_t * obj, lv_point_t * point)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
+
+    lv_point_t p_trans = *point;
+    lv_obj_transform_point(obj, &p_trans, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
+
+    lv_area_t obj_coords = obj->coords;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
+    }
+
+    if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
+        int32_t i;
+        for(i = (int32_t)lv_obj_get_child_count(obj) - 1; i >= 0; i--) {
+            lv_obj_t * found = search_linear(lv_obj_get_child(obj, i), &p_trans);
+            if(found) return found;
+        }
+    }
+
+    return hit_test_ok ? obj : NULL;
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return (uint32_t)now_ms();
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_OBJ_HIT_INDEX_BENCH*/
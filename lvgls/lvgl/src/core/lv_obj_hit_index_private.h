@@ -0,0 +1,96 @@
+/**
+ * @file lv_obj_hit_index_private.h
+ *
+ */
+
+#ifndef LV_OBJ_HIT_INDEX_PRIVATE_H
+#define LV_OBJ_HIT_INDEX_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj.h"
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * A uniform grid over the children of an object. Each cell lists the indices of the children
+ * whose "reach area" (click area and coordinates with the extra draw size) overlaps the cell.
+ * Only these children can be found by `lv_indev_search_obj()` on a point in the cell.
+ * The transformed children are stored in the `always` list as they can be found anywhere.
+ */
+typedef struct lv_obj_hit_index_t {
+    uint32_t gen;               /**< The value of the global generation counter when it was built*/
+    uint32_t seen_gen;          /**< The generation counter at the last search*/
+    bool built;
+    lv_area_t bbox;             /**< Bounding box of the indexed children*/
+    int32_t cell_w;
+    int32_t cell_h;
+    uint16_t col_cnt;
+    uint16_t row_cnt;
+    uint16_t always_cnt;
+    uint16_t * always;          /**< Indices of the children which are always checked*/
+    uint32_t * cell_start;      /**< Start of each cell's list in `items`. `col_cnt * row_cnt + 1` elements*/
+    uint16_t * items;           /**< Ascending child indices of the cells*/
+} lv_obj_hit_index_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Search the children of an object which are on a point, the same way and in the same order
+ * as `lv_indev_search_obj()` would do, but check only the children whose area can contain the point.
+ * @param obj       an object with at least `LV_OBJ_HIT_INDEX_MIN_CHILD` children
+ * @param point     the point already transformed to the object's coordinate system
+ * @return          the found object or NULL
+ */
+lv_obj_t * lv_obj_hit_index_search_children(lv_obj_t * obj, lv_point_t * point);
+
+/**
+ * Mark all hit-test indices as outdated. Needs to be called when the coordinates,
+ * click area, extra draw size, layer type or the order of any object changes.
+ */
+void lv_obj_hit_index_invalidate(void);
+
+/**
+ * Free the hit-test index of an object
+ * @param obj       pointer to an object
+ */
+void lv_obj_hit_index_delete(lv_obj_t * obj);
+
+/**
+ * Get the statistics of the hit-test indices
+ * @param build     store the number of index (re)builds here (can be NULL)
+ * @param search    store the number of searches through the indices here (can be NULL)
+ */
+void lv_obj_hit_index_get_stat(uint32_t * build, uint32_t * search);
+
+#else
+
+#define lv_obj_hit_index_invalidate()
+
+#endif /*LV_OBJ_HIT_INDEX_MIN_CHILD*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_HIT_INDEX_PRIVATE_H*/
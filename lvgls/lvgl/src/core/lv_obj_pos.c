@@ -11,6 +11,7 @@
 #include "lv_obj_event_private.h"
 #include "lv_obj_draw_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
@@ -31,7 +32,8 @@
  **********************/
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
-static void layout_update_core(lv_obj_t * obj);
+static uint32_t layout_update_core(lv_obj_t * obj);
+static void mark_layout_child_inv(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 
 /**********************
@@ -179,6 +181,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
 
     /*Set the length and height
      *Be sure the content is not scrolled in an invalid position on the new size*/
+    lv_obj_hit_index_invalidate();
     obj->coords.y2 = obj->coords.y1 + h - 1;
     if(lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
         obj->coords.x1 = obj->coords.x2 - w + 1;
@@ -197,6 +200,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_layout_child_inv(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -280,6 +284,7 @@ bool lv_obj_is_layout_positioned(const lv_obj_t * obj)
 void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
+    mark_layout_child_inv(obj);
 
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
@@ -300,14 +305,22 @@ void lv_obj_update_layout(const lv_obj_t * obj)
     update_layout_mutex = true;
 
     lv_obj_t * scr = lv_obj_get_screen(obj);
+    uint32_t updated_cnt = 0;
     /*Repeat until there are no more layout invalidations*/
     while(scr->scr_layout_inv) {
         LV_LOG_TRACE("Layout update begin");
         scr->scr_layout_inv = 0;
-        layout_update_core(scr);
+        updated_cnt += layout_update_core(scr);
         LV_LOG_TRACE("Layout update end");
     }
 
+#if LV_USE_PERF_MONITOR
+    lv_display_t * disp = lv_obj_get_display(scr);
+    if(disp) disp->perf_sysmon_info.measured.layout_obj_cnt += updated_cnt;
+#else
+    LV_UNUSED(updated_cnt);
+#endif
+
     update_layout_mutex = false;
     LV_PROFILER_END;
 }
@@ -732,6 +745,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
         if(!on1) lv_obj_scrollbar_invalidate(parent);
     }
 
+    lv_obj_hit_index_invalidate();
     obj->coords.x1 += diff.x;
     obj->coords.y1 += diff.y;
     obj->coords.x2 += diff.x;
@@ -757,6 +771,7 @@ void lv_obj_move_children_by(lv_obj_t * obj, int32_t x_diff, int32_t y_diff, boo
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
+    if(child_cnt) lv_obj_hit_index_invalidate();
     for(i = 0; i < child_cnt; i++) {
         lv_obj_t * child = obj->spec_attr->children[i];
         if(ignore_floating && lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) continue;
@@ -923,6 +938,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    lv_obj_hit_index_invalidate();
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1123,13 +1139,25 @@ static int32_t calc_content_height(lv_obj_t * obj)
     return LV_MAX(self_h, child_res + space_bottom);
 }
 
-static void layout_update_core(lv_obj_t * obj)
+/**
+ * Update the layout of the invalidated objects in a subtree.
+ * Only the children with something to update, or with such descendants, are visited.
+ * @param obj   root of the subtree
+ * @return      number of objects whose size, position and layout were recalculated
+ */
+static uint32_t layout_update_core(lv_obj_t * obj)
 {
+    uint32_t updated_cnt = 0;
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+    if(obj->layout_child_inv) {
+        obj->layout_child_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            if(child->layout_inv || child->layout_child_inv || child->readjust_scroll_after_layout) {
+                updated_cnt += layout_update_core(child);
+            }
+        }
     }
 
     if(obj->layout_inv) {
@@ -1140,12 +1168,29 @@ static void layout_update_core(lv_obj_t * obj)
         if(child_cnt > 0) {
             lv_layout_apply(obj);
         }
+        updated_cnt++;
     }
 
     if(obj->readjust_scroll_after_layout) {
         obj->readjust_scroll_after_layout = 0;
         lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
     }
+
+    return updated_cnt;
+}
+
+/**
+ * Mark the ancestors of an object to show that they have a descendant to update
+ * @param obj   pointer to an object with layout or scroll update to do
+ */
+static void mark_layout_child_inv(lv_obj_t * obj)
+{
+    /*If a parent is marked its ancestors are marked too (or are being updated now)*/
+    lv_obj_t * parent = obj->parent;
+    while(parent && !parent->layout_child_inv) {
+        parent->layout_child_inv = 1;
+        parent = parent->parent;
+    }
 }
 
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
@@ -44,6 +44,10 @@ struct lv_obj_spec_attr_t {
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+    struct lv_obj_hit_index_t * hit_index;  /**< Grid of the children to speed up the hit-test. Built on demand*/
+#endif
 };
 
 struct lv_obj_t {
@@ -65,6 +69,7 @@ struct lv_obj_t {
     uint16_t layout_inv : 1;
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
+    uint16_t layout_child_inv : 1;  /**< A descendant has a layout or scroll update to do*/
     uint16_t skip_trans : 1;
     uint16_t style_cnt  : 6;
     uint16_t h_layout   : 1;
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
@@ -23,6 +24,10 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+#define style_res_cache LV_GLOBAL_DEFAULT()->style_res_cache
+#define style_res_cache_gen LV_GLOBAL_DEFAULT()->style_res_cache_gen
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -55,6 +60,8 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_part_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -84,6 +91,11 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 void lv_obj_style_init(void)
 {
     lv_ll_init(style_trans_ll_p, sizeof(trans_t));
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    LV_ASSERT((LV_OBJ_STYLE_RES_CACHE_SIZE & (LV_OBJ_STYLE_RES_CACHE_SIZE - 1)) == 0);
+    style_res_cache = lv_malloc_zeroed(LV_OBJ_STYLE_RES_CACHE_SIZE * sizeof(lv_obj_style_res_cache_entry_t));
+    LV_ASSERT_MALLOC(style_res_cache);
+#endif
 }
 
 void lv_obj_style_deinit(void)
@@ -93,6 +105,10 @@ void lv_obj_style_deinit(void)
         lv_free(_style_custom_prop_flag_lookup_table);
         _style_custom_prop_flag_lookup_table = NULL;
     }
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    lv_free(style_res_cache);
+    style_res_cache = NULL;
+#endif
 }
 
 void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selector_t selector)
@@ -247,6 +263,10 @@ void lv_obj_remove_style(lv_obj_t * obj, const lv_style_t * style, lv_style_sele
          *Therefore it doesn't needs to be incremented*/
     }
 
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    if(deleted) style_res_cache_gen++;
+#endif
+
     if(deleted && prop != LV_STYLE_PROP_INV) {
         full_cache_refresh(obj, part);
         lv_obj_refresh_style(obj, part, prop);
@@ -260,6 +280,9 @@ void lv_obj_remove_style_all(lv_obj_t * obj)
 
 void lv_obj_report_style_change(lv_style_t * style)
 {
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    style_res_cache_gen++;
+#endif
     if(!style_refr) return;
     lv_display_t * d = lv_display_get_next(NULL);
 
@@ -276,6 +299,9 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    style_res_cache_gen++;
+#endif
     if(!style_refr) return;
 
     lv_obj_invalidate(obj);
@@ -323,6 +349,14 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+void lv_obj_style_get_res_cache_stat(uint32_t * hit, uint32_t * miss)
+{
+    if(hit) *hit = LV_GLOBAL_DEFAULT()->style_res_cache_hit;
+    if(miss) *miss = LV_GLOBAL_DEFAULT()->style_res_cache_miss;
+}
+#endif
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
@@ -611,6 +645,10 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
 void lv_obj_update_layer_type(lv_obj_t * obj)
 {
     lv_layer_type_t layer_type = calculate_layer_type(obj);
+    lv_layer_type_t layer_type_old = obj->spec_attr ? obj->spec_attr->layer_type : LV_LAYER_TYPE_NONE;
+    /*The transformed objects can't be indexed for the hit-test*/
+    if(layer_type != layer_type_old) lv_obj_hit_index_invalidate();
+
     if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
     else if(layer_type != LV_LAYER_TYPE_NONE) {
         lv_obj_allocate_spec_attr(obj);
@@ -748,6 +786,47 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Same as `get_prop_core()` but try to get the result from the resolved style property cache first.
+ * The entries are invalidated at once by increasing the style generation on any style change.
+ */
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v)
+{
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    /*Nothing to cache without styles*/
+    if(obj->style_cnt == 0) return LV_STYLE_RES_NOT_FOUND;
+
+    uint32_t h = (uint32_t)(lv_uintptr_t)obj * 2654435761u;
+    h ^= (selector ^ ((uint32_t)prop << 24)) * 2246822519u;
+    h ^= h >> 15;
+    lv_obj_style_res_cache_entry_t * e = &style_res_cache[h & (LV_OBJ_STYLE_RES_CACHE_SIZE - 1)];
+
+    if(e->obj == obj && e->gen == style_res_cache_gen && e->prop == prop &&
+       e->selector == selector && e->skip_trans == obj->skip_trans) {
+        LV_GLOBAL_DEFAULT()->style_res_cache_hit++;
+        if(!e->found) return LV_STYLE_RES_NOT_FOUND;
+        *v = e->value;
+        return LV_STYLE_RES_FOUND;
+    }
+
+    LV_GLOBAL_DEFAULT()->style_res_cache_miss++;
+    lv_style_res_t found = get_prop_core(obj, selector, prop, v);
+
+    e->obj = obj;
+    e->gen = style_res_cache_gen;
+    e->prop = prop;
+    e->selector = selector;
+    e->skip_trans = obj->skip_trans;
+    e->found = found == LV_STYLE_RES_FOUND;
+    if(e->found) e->value = *v;
+
+    return found;
+#else
+    return get_prop_core(obj, selector, prop, v);
+#endif
+}
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -1065,7 +1144,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
 #endif
     {
-        found = get_prop_core(obj, selector, prop, value_act);
+        found = get_prop_cached(obj, selector, prop, value_act);
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
@@ -1092,7 +1171,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 #endif
             {
                 selector = part | obj->state;
-                found = get_prop_core(obj, selector, prop, value_act);
+                found = get_prop_cached(obj, selector, prop, value_act);
                 if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
             }
             /*Check the parent too.*/
@@ -117,6 +117,16 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
  */
 void lv_obj_enable_style_refresh(bool en);
 
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+/**
+ * Get the statistics of the resolved style property cache.
+ * Compare them before and after a refresh to see how many lookups a frame needed.
+ * @param hit       store the number of lookups served from the cache here (can be NULL)
+ * @param miss      store the number of lookups which searched the styles of the object here (can be NULL)
+ */
+void lv_obj_style_get_res_cache_stat(uint32_t * hit, uint32_t * miss);
+#endif
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
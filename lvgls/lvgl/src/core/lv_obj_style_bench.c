@@ -0,0 +1,183 @@
+/**
+ * @file lv_obj_style_bench.c
+ *
+ * Benchmark of the style property lookups with a screen of widgets.
+ * It's a standalone program which is compiled only if `LV_OBJ_STYLE_BENCH` is defined.
+ *
+ * Build it on a host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_OBJ_STYLE_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o style_bench
+ *
+ * Usage: `./style_bench [frame_cnt]`
+ *
+ * About 200 widgets with shared and local styles are created. In every frame a few values
+ * are changed and the whole screen is redrawn.
+ * With `LV_OBJ_STYLE_RES_CACHE_SIZE > 0` the number of the style property lookups per frame
+ * (as without the cache) and the number of them which still had to search the styles are printed.
+ * The time of a frame is printed too, so build it with `LV_OBJ_STYLE_RES_CACHE_SIZE 0`
+ * to compare the speed. On a 64-bit host an entry of the cache takes 32 bytes
+ * and the whole cache has to fit into `LV_MEM_SIZE`.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_OBJ_STYLE_BENCH
+
+#include "../../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         800
+#define VER_RES         480
+#define ROW_CNT         40
+#define POOL_CNT        ((1024 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint8_t draw_buf[HOR_RES * 40 * 2];
+static uint32_t tick;
+static lv_style_t style_row;
+static lv_style_t style_title;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frame_cnt = argc > 1 ? atoi(argv[1]) : 100;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_style_init(&style_row);
+    lv_style_set_pad_all(&style_row, 4);
+    lv_style_set_radius(&style_row, 6);
+    lv_style_set_bg_color(&style_row, lv_color_hex(0xf0f4f8));
+    lv_style_set_border_width(&style_row, 1);
+
+    lv_style_init(&style_title);
+    lv_style_set_text_color(&style_title, lv_color_hex(0x204080));
+    lv_style_set_text_letter_space(&style_title, 1);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, HOR_RES, VER_RES);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+
+    /*A row is a container with a label, a slider, a switch and a button with a label*/
+    lv_obj_t * labels[ROW_CNT];
+    lv_obj_t * sliders[ROW_CNT];
+    for(i = 0; i < ROW_CNT; i++) {
+        lv_obj_t * row = lv_obj_create(cont);
+        lv_obj_add_style(row, &style_row, 0);
+        lv_obj_set_size(row, 380, 44);
+        lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+        lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+
+        labels[i] = lv_label_create(row);
+        lv_obj_add_style(labels[i], &style_title, 0);
+        lv_obj_set_width(labels[i], 80);
+
+        sliders[i] = lv_slider_create(row);
+        lv_obj_set_width(sliders[i], 120);
+
+        lv_obj_t * sw = lv_switch_create(row);
+        if(i % 2) lv_obj_add_state(sw, LV_STATE_CHECKED);
+
+        lv_obj_t * btn = lv_button_create(row);
+        lv_obj_set_style_bg_color(btn, lv_palette_main(i % LV_PALETTE_LAST), 0);
+        lv_obj_t * btn_label = lv_label_create(btn);
+        lv_label_set_text(btn_label, "OK");
+    }
+
+    /*Draw the first frame to create everything*/
+    lv_refr_now(disp);
+
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    uint32_t hit_start;
+    uint32_t miss_start;
+    lv_obj_style_get_res_cache_stat(&hit_start, &miss_start);
+#endif
+
+    double t_start = now_ms();
+    for(i = 0; i < frame_cnt; i++) {
+        uint32_t row = i % ROW_CNT;
+        lv_label_set_text_fmt(labels[row], "Row %"LV_PRIu32, i);
+        lv_slider_set_value(sliders[row], (i * 7) % 100, LV_ANIM_OFF);
+        lv_obj_invalidate(scr);
+        tick += 33;
+        lv_refr_now(disp);
+    }
+    double t_frames = now_ms() - t_start;
+
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+    uint32_t hit_end;
+    uint32_t miss_end;
+    lv_obj_style_get_res_cache_stat(&hit_end, &miss_end);
+    uint32_t hit_cnt = hit_end - hit_start;
+    uint32_t miss_cnt = miss_end - miss_start;
+    printf("style lookups: %"LV_PRIu32"/frame, searching the styles: %"LV_PRIu32"/frame (hit rate: %"LV_PRIu32" %%)\n",
+           (hit_cnt + miss_cnt) / frame_cnt, miss_cnt / frame_cnt,
+           (uint32_t)((uint64_t)hit_cnt * 100 / LV_MAX(hit_cnt + miss_cnt, 1)));
+#endif
+
+    printf("cache size: %d, %.3f ms/frame\n", LV_OBJ_STYLE_RES_CACHE_SIZE, t_frames / frame_cnt);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return tick;
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_OBJ_STYLE_BENCH*/
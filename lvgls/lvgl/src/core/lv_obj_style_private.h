@@ -31,6 +31,19 @@ struct lv_obj_style_t {
     uint32_t is_trans : 1;
 };
 
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+/** A resolved style property of an object's part in a given state*/
+struct lv_obj_style_res_cache_entry_t {
+    const lv_obj_t * obj;           /**< NULL if the entry is unused*/
+    uint32_t gen;                   /**< Valid only if equals to the global style generation*/
+    lv_style_value_t value;
+    uint32_t selector : 24;
+    uint32_t skip_trans : 1;        /**< The value was resolved while transitions were skipped*/
+    uint32_t found : 1;             /**< 0: none of the object's styles has the property*/
+    lv_style_prop_t prop;
+};
+#endif
+
 struct lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "lv_obj_class_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
@@ -163,6 +164,8 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     lv_obj_allocate_spec_attr(parent);
 
+    lv_obj_hit_index_invalidate();
+
     lv_obj_t * old_parent = obj->parent;
     /*Remove the object from the old parent's child list*/
     int32_t i;
@@ -246,6 +249,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    lv_obj_hit_index_invalidate();
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -269,6 +273,7 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
 
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
+    lv_obj_hit_index_invalidate();
 
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
@@ -576,6 +581,7 @@ static void obj_delete_core(lv_obj_t * obj)
     }
     /*Remove the object from the child list of its parent*/
     else {
+        lv_obj_hit_index_invalidate();
         int32_t id = lv_obj_get_index(obj);
         uint16_t i;
         for(i = id; i < obj->parent->spec_attr->child_cnt - 1; i++) {
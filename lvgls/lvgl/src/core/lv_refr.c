@@ -51,6 +51,18 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+static void flush_area(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, bool last, bool wait);
+static void wait_for_ring_buf(lv_display_t * disp);
+#if LV_REFR_INV_TILE_SIZE
+    static bool inv_tiles_add(lv_display_t * disp, const lv_area_t * area_p);
+    static void inv_tiles_to_areas(lv_display_t * disp);
+    static bool inv_tiles_collect(lv_display_t * disp, uint32_t scale);
+    static void inv_tiles_clear(lv_display_t * disp);
+#endif
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    static bool flush_diff(lv_display_t * disp, lv_draw_buf_t * draw_buf, bool last);
+    static uint32_t flush_diff_hash(const uint8_t * data, uint32_t len);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -276,6 +288,9 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+#if LV_REFR_INV_TILE_SIZE
+        inv_tiles_clear(disp);
+#endif
         return;
     }
 
@@ -315,6 +330,16 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
+#if LV_REFR_INV_TILE_SIZE
+    /*If there is no more place for the area save it in the tile map*/
+    if(disp->inv_tiles_active || disp->inv_p >= LV_INV_BUF_SIZE) {
+        if(inv_tiles_add(disp, &com_area)) {
+            lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
+            return;
+        }
+    }
+#endif
+
     /*Save the area*/
     lv_area_t * tmp_area_p = &com_area;
     if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
@@ -389,10 +414,17 @@ void lv_display_refr_timer(lv_timer_t * tmr)
     /*Do nothing if there is no active screen*/
     if(disp_refr->act_scr == NULL) {
         disp_refr->inv_p = 0;
+#if LV_REFR_INV_TILE_SIZE
+        inv_tiles_clear(disp_refr);
+#endif
         LV_LOG_WARN("there is no active screen");
         goto refr_finish;
     }
 
+#if LV_REFR_INV_TILE_SIZE
+    if(disp_refr->inv_tiles_active) inv_tiles_to_areas(disp_refr);
+#endif
+
     lv_refr_join_area();
     refr_sync_areas();
     refr_invalid_areas();
@@ -421,10 +453,6 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
 refr_finish:
 
-#if LV_DRAW_SW_COMPLEX == 1
-    lv_draw_sw_mask_cleanup();
-#endif
-
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -703,8 +731,12 @@ static void refr_area_part(lv_layer_t * layer)
     disp_refr->refreshed_area = layer->_clip_area;
 
     /* In single buffered mode wait here until the buffer is freed.
-     * Else we would draw into the buffer while it's still being transferred to the display*/
-    if(!lv_display_is_double_buffered(disp_refr)) {
+     * Else we would draw into the buffer while it's still being transferred to the display.
+     * With a ring of buffers wait only if the next buffer is still being transferred.*/
+    if(disp_refr->buf_ring_cnt) {
+        wait_for_ring_buf(disp_refr);
+    }
+    else if(!lv_display_is_double_buffered(disp_refr)) {
         wait_for_flushing(disp_refr);
     }
     /*If the screen is transparent initialize it when the flushing is ready*/
@@ -1159,26 +1191,28 @@ static void draw_buf_flush(lv_display_t * disp)
         lv_draw_dispatch();
     }
 
-    /* In double buffered mode wait until the other buffer is freed
-     * and driver is ready to receive the new buffer.
-     * If we need to wait here it means that the content of one buffer is being sent to display
-     * and other buffer already contains the new rendered image. */
-    if(lv_display_is_double_buffered(disp)) {
-        wait_for_flushing(disp_refr);
-    }
-
-    disp->flushing = 1;
-
-    if(disp->last_area && disp->last_part) disp->flushing_last = 1;
-    else disp->flushing_last = 0;
+    bool flushing_last = disp->last_area && disp->last_part;
 
-    bool flushing_last = disp->flushing_last;
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+        /*If nothing was flushed the buffer is free so render the next part into it too.
+         *The other buffer might be still being flushed.*/
+        if(!flush_diff(disp, layer->draw_buf, flushing_last)) return;
+    }
+    else {
+        flush_area(disp, &disp->refreshed_area, layer->draw_buf->data, flushing_last, false);
+    }
+#else
+    flush_area(disp, &disp->refreshed_area, layer->draw_buf->data, flushing_last, false);
+#endif
 
-    if(disp->flush_cb) {
-        call_flush_cb(disp, &disp->refreshed_area, layer->draw_buf->data);
+    /*With a ring of buffers continue with the next one*/
+    if(disp->buf_ring_cnt) {
+        disp->buf_ring_act = (disp->buf_ring_act + 1) % disp->buf_ring_cnt;
+        disp->buf_act = &disp->buf_ring[disp->buf_ring_act];
     }
     /*If there are 2 buffers swap them. With direct mode swap only on the last area*/
-    if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
+    else if(lv_display_is_double_buffered(disp) && (disp->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT || flushing_last)) {
         if(disp->buf_act == disp->buf_1) {
             disp->buf_act = disp->buf_2;
         }
@@ -1188,6 +1222,41 @@ static void draw_buf_flush(lv_display_t * disp)
     }
 }
 
+/**
+ * Pass an area to `flush_cb` when the driver is ready to receive it
+ * @param disp      pointer to the display
+ * @param area      the area to flush
+ * @param px_map    the pixels of the area
+ * @param last      true: it's the last area of the refresh
+ * @param wait      true: wait for the previous flush even in single buffered mode,
+ *                  e.g. when a part of the same buffer is flushed again
+ */
+static void flush_area(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map, bool last, bool wait)
+{
+    /* In double buffered mode wait until the other buffer is freed
+     * and driver is ready to receive the new buffer.
+     * If we need to wait here it means that the content of one buffer is being sent to display
+     * and other buffer already contains the new rendered image.
+     * With a ring of buffers the driver queues the flushes so no waiting is needed. */
+    if(disp->buf_ring_cnt) {
+        /*Without `flush_cb` nothing would report the flush as ready*/
+        if(disp->flush_cb) {
+            disp->flush_issued_cnt++;
+            disp->buf_ring_issued[disp->buf_ring_act] = disp->flush_issued_cnt;
+        }
+    }
+    else if(wait || lv_display_is_double_buffered(disp)) {
+        wait_for_flushing(disp);
+    }
+
+    disp->flushing = 1;
+    disp->flushing_last = last ? 1 : 0;
+
+    if(disp->flush_cb) {
+        call_flush_cb(disp, area, px_map);
+    }
+}
+
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
 {
     LV_PROFILER_BEGIN;
@@ -1237,3 +1306,362 @@ static void wait_for_flushing(lv_display_t * disp)
     LV_LOG_TRACE("end");
     LV_PROFILER_END;
 }
+
+/**
+ * Wait until `buf_act` of a ring of buffers can be rendered,
+ * i.e. all the flushes from it are ready
+ */
+static void wait_for_ring_buf(lv_display_t * disp)
+{
+    /*The counters can overflow so compare their difference*/
+    uint32_t issued = disp->buf_ring_issued[disp->buf_ring_act];
+    if((int32_t)(issued - disp->flush_ready_cnt - disp->flush_waited_cnt) <= 0) return;
+
+    LV_PROFILER_BEGIN;
+    lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_START, NULL);
+
+    while((int32_t)(issued - disp->flush_ready_cnt - disp->flush_waited_cnt) > 0) {
+        if(disp->flush_wait_cb) {
+            /*`flush_wait_cb` returns when the oldest flush is ready.
+             *The driver doesn't need to call `lv_display_flush_ready()` in this case.*/
+            uint32_t ready_cnt = disp->flush_ready_cnt;
+            disp->flush_wait_cb(disp);
+            if(disp->flush_ready_cnt == ready_cnt) disp->flush_waited_cnt++;
+        }
+#if LV_USE_OS
+        else lv_thread_sync_wait(&disp->flush_sync);
+#endif
+    }
+
+    lv_display_send_event(disp, LV_EVENT_FLUSH_WAIT_FINISH, NULL);
+    LV_PROFILER_END;
+}
+
+#if LV_REFR_INV_TILE_SIZE
+
+/**
+ * Mark the tiles touched by an area as invalid.
+ * When the tile map is activated the already saved areas are moved to it too.
+ * @param disp      pointer to a display
+ * @param area_p    the area to add. Already clipped to the screen.
+ * @return          true: the area is saved in the tile map; false: the tile map couldn't be allocated
+ */
+static bool inv_tiles_add(lv_display_t * disp, const lv_area_t * area_p)
+{
+    uint32_t cols = (lv_display_get_horizontal_resolution(disp) + LV_REFR_INV_TILE_SIZE - 1) / LV_REFR_INV_TILE_SIZE;
+    uint32_t rows = (lv_display_get_vertical_resolution(disp) + LV_REFR_INV_TILE_SIZE - 1) / LV_REFR_INV_TILE_SIZE;
+    uint32_t stride = (cols + 7) >> 3;
+
+    if(disp->inv_tiles == NULL) {
+        disp->inv_tiles = lv_malloc_zeroed(stride * rows);
+        LV_ASSERT_MALLOC(disp->inv_tiles);
+        if(disp->inv_tiles == NULL) return false;
+        disp->inv_tiles_size = stride * rows;
+    }
+
+    if(!disp->inv_tiles_active) {
+        disp->inv_tiles_active = 1;
+        uint32_t i;
+        uint32_t inv_p = disp->inv_p;
+        disp->inv_p = 0;
+        for(i = 0; i < inv_p; i++) inv_tiles_add(disp, &disp->inv_areas[i]);
+    }
+
+    uint32_t c1 = (uint32_t)area_p->x1 / LV_REFR_INV_TILE_SIZE;
+    uint32_t c2 = (uint32_t)area_p->x2 / LV_REFR_INV_TILE_SIZE;
+    uint32_t r1 = (uint32_t)area_p->y1 / LV_REFR_INV_TILE_SIZE;
+    uint32_t r2 = (uint32_t)area_p->y2 / LV_REFR_INV_TILE_SIZE;
+    uint32_t r;
+    uint32_t c;
+    for(r = r1; r <= r2; r++) {
+        uint8_t * row = &disp->inv_tiles[r * stride];
+        for(c = c1; c <= c2; c++) {
+            row[c >> 3] |= 1 << (c & 0x7);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Convert the tile map to at most `LV_INV_BUF_SIZE` areas in `inv_areas`.
+ * If the invalid tiles can't be described by that many areas
+ * the tile map is evaluated with larger and larger blocks of tiles.
+ * @param disp      pointer to a display
+ */
+static void inv_tiles_to_areas(lv_display_t * disp)
+{
+    LV_PROFILER_BEGIN;
+    uint32_t scale = 1;
+    while(inv_tiles_collect(disp, scale) == false) {
+        scale *= 2;
+    }
+
+    /*Without the tile map the whole screen would have been redrawn*/
+    uint64_t px_num = (uint64_t)lv_display_get_horizontal_resolution(disp) * lv_display_get_vertical_resolution(disp);
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        px_num -= lv_area_get_size(&disp->inv_areas[i]);
+    }
+    disp->inv_tiles_saved_px += px_num;
+
+    lv_memzero(disp->inv_tiles, disp->inv_tiles_size);
+    disp->inv_tiles_active = 0;
+    LV_PROFILER_END;
+}
+
+/**
+ * Collect the invalid blocks of `scale x scale` tiles into `inv_areas`.
+ * Horizontal runs of blocks are saved as one area and
+ * vertically adjacent runs with the same width are merged.
+ * @param disp      pointer to a display
+ * @param scale     number of tiles in a block in both directions
+ * @return          true: all invalid blocks are saved; false: `inv_areas` is too small
+ */
+static bool inv_tiles_collect(lv_display_t * disp, uint32_t scale)
+{
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+    uint32_t cols = (hor_res + LV_REFR_INV_TILE_SIZE - 1) / LV_REFR_INV_TILE_SIZE;
+    uint32_t rows = (ver_res + LV_REFR_INV_TILE_SIZE - 1) / LV_REFR_INV_TILE_SIZE;
+    uint32_t stride = (cols + 7) >> 3;
+
+    disp->inv_p = 0;
+    lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
+
+    uint32_t r;
+    for(r = 0; r < rows; r += scale) {
+        uint32_t r_end = LV_MIN(r + scale, rows);
+        int32_t run_start = -1;
+        uint32_t c;
+        for(c = 0; c < cols + scale; c += scale) {
+            bool inv = false;
+            if(c < cols) {
+                uint32_t c_end = LV_MIN(c + scale, cols);
+                uint32_t rb;
+                uint32_t cb;
+                for(rb = r; rb < r_end && !inv; rb++) {
+                    const uint8_t * row = &disp->inv_tiles[rb * stride];
+                    for(cb = c; cb < c_end; cb++) {
+                        if(row[cb >> 3] & (1 << (cb & 0x7))) {
+                            inv = true;
+                            break;
+                        }
+                    }
+                }
+            }
+
+            if(inv) {
+                if(run_start < 0) run_start = c;
+                continue;
+            }
+
+            if(run_start < 0) continue;
+
+            /*A run of invalid blocks has ended, save it*/
+            lv_area_t a;
+            a.x1 = run_start * LV_REFR_INV_TILE_SIZE;
+            a.x2 = LV_MIN((int32_t)(c * LV_REFR_INV_TILE_SIZE), hor_res) - 1;
+            a.y1 = r * LV_REFR_INV_TILE_SIZE;
+            a.y2 = LV_MIN((int32_t)(r_end * LV_REFR_INV_TILE_SIZE), ver_res) - 1;
+            run_start = -1;
+
+            /*Continue an area of the previous block row if it has the same width*/
+            uint32_t i;
+            for(i = 0; i < disp->inv_p; i++) {
+                lv_area_t * prev = &disp->inv_areas[i];
+                if(prev->y2 == a.y1 - 1 && prev->x1 == a.x1 && prev->x2 == a.x2) {
+                    prev->y2 = a.y2;
+                    break;
+                }
+            }
+
+            if(i == disp->inv_p) {
+                if(disp->inv_p >= LV_INV_BUF_SIZE) return false;
+                disp->inv_areas[disp->inv_p] = a;
+                disp->inv_p++;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Drop the content of the tile map
+ * @param disp      pointer to a display
+ */
+static void inv_tiles_clear(lv_display_t * disp)
+{
+    if(disp->inv_tiles) lv_memzero(disp->inv_tiles, disp->inv_tiles_size);
+    disp->inv_tiles_active = 0;
+}
+
+#endif /*LV_REFR_INV_TILE_SIZE*/
+
+#if LV_REFR_FLUSH_DIFF_SEG_W
+
+/**
+ * Flush only the rows and columns of the rendered part which differ from the flushed content.
+ * The hashes of the row segments fully covered by the part are compared with the stored ones,
+ * the partially covered segments are considered changed. The runs of changed rows are flushed
+ * separately with the columns limited to the changed segments.
+ * @param disp      pointer to the display
+ * @param draw_buf  the draw buffer with the rendered `disp->refreshed_area`
+ * @param last      true: it's the last part of the refresh
+ * @return          true: `flush_cb` was called; false: nothing has changed so the buffer is not used
+ */
+static bool flush_diff(lv_display_t * disp, lv_draw_buf_t * draw_buf, bool last)
+{
+    const lv_area_t * area = &disp->refreshed_area;
+    uint32_t px_bpp = lv_color_format_get_bpp(draw_buf->header.cf);
+    int32_t hor_res = lv_display_get_horizontal_resolution(disp);
+    int32_t ver_res = lv_display_get_vertical_resolution(disp);
+
+    /*Formats with less than 1 byte per pixel can't be shrunk horizontally*/
+    if(px_bpp < 8 || area->x1 < 0 || area->y1 < 0 || area->x2 >= hor_res || area->y2 >= ver_res) {
+        flush_area(disp, area, draw_buf->data, last, false);
+        return true;
+    }
+
+    if(disp->flush_diff_hashes == NULL) {
+        uint32_t seg_cnt = (hor_res + LV_REFR_FLUSH_DIFF_SEG_W - 1) / LV_REFR_FLUSH_DIFF_SEG_W;
+        disp->flush_diff_hashes = lv_malloc_zeroed(seg_cnt * ver_res * sizeof(uint32_t));
+        LV_ASSERT_MALLOC(disp->flush_diff_hashes);
+        if(disp->flush_diff_hashes == NULL) {
+            flush_area(disp, area, draw_buf->data, last, false);
+            return true;
+        }
+        disp->flush_diff_seg_cnt = seg_cnt;
+    }
+
+    LV_PROFILER_BEGIN;
+
+    uint32_t px_size = px_bpp / 8;
+    uint32_t stride = draw_buf->header.stride;
+    int32_t seg_first = area->x1 / LV_REFR_FLUSH_DIFF_SEG_W;
+    int32_t seg_last = area->x2 / LV_REFR_FLUSH_DIFF_SEG_W;
+
+    /*Find the changed segments and mark the changed rows in `row_changed`*/
+    int32_t h = lv_area_get_height(area);
+    uint8_t row_changed_static[64];
+    uint8_t * row_changed = h <= 64 ? row_changed_static : lv_malloc(h);
+    if(row_changed == NULL) {
+        LV_PROFILER_END;
+        flush_area(disp, area, draw_buf->data, last, false);
+        return true;
+    }
+
+    int32_t cx1 = area->x2 + 1;
+    int32_t cx2 = area->x1 - 1;
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        const uint8_t * row_px = draw_buf->data + (y - area->y1) * stride;
+        uint32_t * row_hashes = &disp->flush_diff_hashes[y * disp->flush_diff_seg_cnt];
+        bool changed = false;
+        int32_t seg;
+        for(seg = seg_first; seg <= seg_last; seg++) {
+            int32_t seg_x1 = seg * LV_REFR_FLUSH_DIFF_SEG_W;
+            int32_t seg_x2 = LV_MIN(seg_x1 + LV_REFR_FLUSH_DIFF_SEG_W, hor_res) - 1;
+            bool seg_changed;
+            if(seg_x1 < area->x1 || seg_x2 > area->x2) {
+                /*The rest of the segment is not known*/
+                row_hashes[seg] = 0;
+                seg_changed = true;
+            }
+            else {
+                uint32_t hash = flush_diff_hash(row_px + (seg_x1 - area->x1) * px_size,
+                                                (seg_x2 - seg_x1 + 1) * px_size);
+                seg_changed = hash != row_hashes[seg];
+                row_hashes[seg] = hash;
+            }
+
+            if(seg_changed) {
+                changed = true;
+                cx1 = LV_MIN(cx1, LV_MAX(seg_x1, area->x1));
+                cx2 = LV_MAX(cx2, LV_MIN(seg_x2, area->x2));
+            }
+        }
+        row_changed[y - area->y1] = changed;
+    }
+
+    uint32_t area_bytes = lv_area_get_size(area) * px_size;
+    uint32_t flushed_bytes = 0;
+    int32_t w = lv_area_get_width(area);
+    int32_t cw = cx2 - cx1 + 1;
+    uint32_t new_stride = lv_draw_buf_width_to_stride(cw, draw_buf->header.cf);
+    bool flushed = false;
+
+    /*Flush the runs of the changed rows*/
+    y = area->y1;
+    while(y <= area->y2) {
+        if(!row_changed[y - area->y1]) {
+            y++;
+            continue;
+        }
+
+        lv_area_t run;
+        run.x1 = cx1;
+        run.x2 = cx2;
+        run.y1 = y;
+        while(y <= area->y2 && row_changed[y - area->y1]) y++;
+        run.y2 = y - 1;
+
+        /*Pack the changed columns to the beginning of the run's rows. It only moves data backward.*/
+        uint8_t * run_px = draw_buf->data + (run.y1 - area->y1) * stride;
+        if(cw != w) {
+            int32_t ry;
+            for(ry = 0; ry <= run.y2 - run.y1; ry++) {
+                lv_memmove(run_px + ry * new_stride, run_px + ry * stride + (cx1 - area->x1) * px_size, cw * px_size);
+            }
+        }
+
+        bool run_last = last;
+        if(last) {
+            int32_t ny;
+            for(ny = y; ny <= area->y2; ny++) {
+                if(row_changed[ny - area->y1]) {
+                    run_last = false;
+                    break;
+                }
+            }
+        }
+
+        flush_area(disp, &run, run_px, run_last, flushed);
+        flushed = true;
+        flushed_bytes += lv_area_get_size(&run) * px_size;
+    }
+
+    /*Let the driver know about the end of the refresh even if nothing has changed*/
+    if(!flushed && last) {
+        lv_area_t px_area;
+        lv_area_set(&px_area, area->x1, area->y1, area->x1, area->y1);
+        flush_area(disp, &px_area, draw_buf->data, true, false);
+        flushed = true;
+        flushed_bytes += px_size;
+    }
+
+    disp->flush_diff_saved_bytes += area_bytes - flushed_bytes;
+
+    if(row_changed != row_changed_static) lv_free(row_changed);
+
+    LV_PROFILER_END;
+    return flushed;
+}
+
+/**
+ * FNV-1a hash of the pixels. 0 is reserved for the unknown content.
+ */
+static uint32_t flush_diff_hash(const uint8_t * data, uint32_t len)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < len; i++) {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+
+    return hash == 0 ? 1 : hash;
+}
+
+#endif /*LV_REFR_FLUSH_DIFF_SEG_W*/
@@ -46,6 +46,7 @@ static void set_y_anim(void * obj, int32_t v);
 static void scr_anim_completed(lv_anim_t * a);
 static bool is_out_anim(lv_screen_load_anim_t a);
 static void disp_event_cb(lv_event_t * e);
+static void free_buffer_ring(lv_display_t * disp);
 
 /**********************
  *  STATIC VARIABLES
@@ -198,6 +199,13 @@ void lv_display_delete(lv_display_t * disp)
     }
 
     lv_ll_clear(&disp->sync_areas);
+    free_buffer_ring(disp);
+#if LV_REFR_INV_TILE_SIZE
+    lv_free(disp->inv_tiles);
+#endif
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    lv_free(disp->flush_diff_hashes);
+#endif
     lv_ll_remove(disp_ll_p, disp);
     if(disp->refr_timer) lv_timer_delete(disp->refr_timer);
 
@@ -408,6 +416,8 @@ void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_d
     if(disp == NULL) disp = lv_display_get_default();
     if(disp == NULL) return;
 
+    free_buffer_ring(disp);
+
     disp->buf_1 = buf1;
     disp->buf_2 = buf2;
     disp->buf_act = disp->buf_1;
@@ -444,6 +454,55 @@ void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint3
     lv_display_set_render_mode(disp, render_mode);
 }
 
+void lv_display_set_buffer_ring(lv_display_t * disp, void * bufs[], uint32_t buf_cnt, uint32_t buf_size)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    LV_ASSERT_MSG(buf_cnt >= 2, "At least 2 buffers are required");
+    if(buf_cnt < 2) return;
+
+    lv_color_format_t cf = lv_display_get_color_format(disp);
+    uint32_t w = lv_display_get_horizontal_resolution(disp);
+    LV_ASSERT_MSG(w != 0, "display resolution is 0");
+
+    uint32_t stride = lv_draw_buf_width_to_stride(w, cf);
+    uint32_t h = buf_size / stride;
+    LV_ASSERT_MSG(h != 0, "the buffer is too small");
+
+    lv_draw_buf_t * ring = lv_malloc_zeroed(buf_cnt * sizeof(lv_draw_buf_t));
+    uint32_t * ring_issued = lv_malloc_zeroed(buf_cnt * sizeof(uint32_t));
+    LV_ASSERT_MALLOC(ring);
+    LV_ASSERT_MALLOC(ring_issued);
+    if(ring == NULL || ring_issued == NULL) {
+        lv_free(ring);
+        lv_free(ring_issued);
+        return;
+    }
+
+    uint32_t i;
+    for(i = 0; i < buf_cnt; i++) {
+        LV_ASSERT_MSG(bufs[i] != NULL, "Null buffer");
+        LV_ASSERT_FORMAT_MSG(bufs[i] == lv_draw_buf_align(bufs[i], cf), "bufs[%d] is not aligned: %p", (int)i, bufs[i]);
+        lv_draw_buf_init(&ring[i], w, h, cf, stride, bufs[i], buf_size);
+    }
+
+    /*Frees the previous ring too*/
+    lv_display_set_draw_buffers(disp, &ring[0], &ring[1]);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    disp->buf_ring = ring;
+    disp->buf_ring_cnt = buf_cnt;
+    disp->buf_ring_act = 0;
+    disp->buf_ring_issued = ring_issued;
+    disp->flush_issued_cnt = 0;
+    disp->flush_ready_cnt = 0;
+    disp->flush_waited_cnt = 0;
+#if LV_USE_OS
+    lv_thread_sync_init(&disp->flush_sync);
+#endif
+}
+
 void lv_display_set_render_mode(lv_display_t * disp, lv_display_render_mode_t render_mode)
 {
     if(disp == NULL) disp = lv_display_get_default();
@@ -477,6 +536,15 @@ void lv_display_set_color_format(lv_display_t * disp, lv_color_format_t color_fo
     if(disp->buf_1) disp->buf_1->header.cf = color_format;
     if(disp->buf_2) disp->buf_2->header.cf = color_format;
 
+    uint32_t i;
+    for(i = 0; i < disp->buf_ring_cnt; i++) {
+        disp->buf_ring[i].header.cf = color_format;
+    }
+
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    lv_display_reset_flush_diff(disp);
+#endif
+
     lv_display_send_event(disp, LV_EVENT_COLOR_FORMAT_CHANGED, NULL);
 }
 
@@ -507,6 +575,28 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
     disp->flushing = 0;
+
+    if(disp->buf_ring_cnt) {
+        disp->flush_ready_cnt++;
+#if LV_USE_OS
+        lv_thread_sync_signal(&disp->flush_sync);
+#endif
+    }
+}
+
+LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready_isr(lv_display_t * disp)
+{
+    disp->flushing = 0;
+
+    if(disp->buf_ring_cnt) {
+        disp->flush_ready_cnt++;
+#if LV_USE_OS
+        /*Not all OSes can signal from an interrupt (e.g. pthread)*/
+        if(lv_thread_sync_signal_isr(&disp->flush_sync) != LV_RESULT_OK) {
+            lv_thread_sync_signal(&disp->flush_sync);
+        }
+#endif
+    }
 }
 
 LV_ATTRIBUTE_FLUSH_READY bool lv_display_flush_is_last(lv_display_t * disp)
@@ -593,6 +683,11 @@ void lv_screen_load_anim(lv_obj_t * new_scr, lv_screen_load_anim_t anim_type, ui
         return;
     }
 
+#if LV_USE_IMAGE_PREFETCH
+    /*Start decoding the images while the screen is waiting for the delay or animation*/
+    lv_image_prefetch_obj_tree(new_scr);
+#endif
+
     /*If another screen load animation is in progress
      *make target screen loaded immediately. */
     if(d->scr_to_load && act_scr != d->scr_to_load) {
@@ -780,6 +875,10 @@ uint32_t lv_display_remove_event_cb_with_user_data(lv_display_t * disp, lv_event
 lv_result_t lv_display_send_event(lv_display_t * disp, lv_event_code_t code, void * param)
 {
 
+#if LV_USE_PROFILER
+    lv_event_count_sent(code);
+#endif
+
     lv_event_t e;
     lv_memzero(&e, sizeof(e));
     e.code = code;
@@ -885,6 +984,43 @@ bool lv_display_is_invalidation_enabled(lv_display_t * disp)
     return (disp->inv_en_cnt > 0);
 }
 
+#if LV_REFR_INV_TILE_SIZE
+uint64_t lv_display_get_inv_tiles_saved_px(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        LV_LOG_WARN("no display registered");
+        return 0;
+    }
+
+    return disp->inv_tiles_saved_px;
+}
+#endif
+
+#if LV_REFR_FLUSH_DIFF_SEG_W
+uint64_t lv_display_get_flush_diff_saved_bytes(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) {
+        LV_LOG_WARN("no display registered");
+        return 0;
+    }
+
+    return disp->flush_diff_saved_bytes;
+}
+
+void lv_display_reset_flush_diff(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return;
+
+    if(disp->flush_diff_hashes) {
+        lv_memzero(disp->flush_diff_hashes,
+                   disp->flush_diff_seg_cnt * lv_display_get_vertical_resolution(disp) * sizeof(uint32_t));
+    }
+}
+#endif
+
 lv_timer_t * lv_display_get_refr_timer(lv_display_t * disp)
 {
     if(!disp) disp = lv_display_get_default();
@@ -1033,6 +1169,19 @@ static void update_resolution(lv_display_t * disp)
     lv_memzero(disp->inv_areas, sizeof(disp->inv_areas));
     lv_memzero(disp->inv_area_joined, sizeof(disp->inv_area_joined));
     disp->inv_p = 0;
+#if LV_REFR_INV_TILE_SIZE
+    /*The tile map depends on the resolution, it will be reallocated when needed*/
+    lv_free(disp->inv_tiles);
+    disp->inv_tiles = NULL;
+    disp->inv_tiles_size = 0;
+    disp->inv_tiles_active = 0;
+#endif
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    /*The hashes depend on the resolution, they will be reallocated when needed*/
+    lv_free(disp->flush_diff_hashes);
+    disp->flush_diff_hashes = NULL;
+    disp->flush_diff_seg_cnt = 0;
+#endif
     lv_obj_invalidate(disp->sys_layer);
 
     lv_obj_tree_walk(NULL, invalidate_layout_cb, NULL);
@@ -1132,3 +1281,18 @@ static void disp_event_cb(lv_event_t * e)
             break;
     }
 }
+
+static void free_buffer_ring(lv_display_t * disp)
+{
+    if(disp->buf_ring == NULL) return;
+
+#if LV_USE_OS
+    lv_thread_sync_delete(&disp->flush_sync);
+#endif
+    lv_free(disp->buf_ring);
+    lv_free(disp->buf_ring_issued);
+    disp->buf_ring = NULL;
+    disp->buf_ring_issued = NULL;
+    disp->buf_ring_cnt = 0;
+    disp->buf_ring_act = 0;
+}
@@ -249,6 +249,23 @@ void lv_display_set_buffers(lv_display_t * disp, void * buf1, void * buf2, uint3
  */
 void lv_display_set_draw_buffers(lv_display_t * disp, lv_draw_buf_t * buf1, lv_draw_buf_t * buf2);
 
+/**
+ * Set a ring of `buf_cnt` equally sized buffers for partial rendering.
+ * While a buffer is being flushed, the next parts are rendered into the following buffers,
+ * so LVGL waits only if all the buffers are being flushed.
+ * `flush_cb` is called again before the earlier flushes are ready, therefore it should only
+ * queue the transfer (e.g. start a DMA) and `lv_display_flush_ready()` needs to be called
+ * for each `flush_cb` call in the same order.
+ * If `flush_wait_cb` is set, each of its returns means that the oldest flush is ready. If the driver
+ * calls `lv_display_flush_ready()` too, it should be called before `flush_wait_cb` returns.
+ * With an OS LVGL sleeps on a `lv_thread_sync_t` while waiting for a free buffer.
+ * @param disp              pointer to a display
+ * @param bufs              array of `buf_cnt` buffers aligned to `LV_DRAW_BUF_ALIGN`
+ * @param buf_cnt           number of buffers (at least 2)
+ * @param buf_size          size of each buffer in bytes
+ */
+void lv_display_set_buffer_ring(lv_display_t * disp, void * bufs[], uint32_t buf_cnt, uint32_t buf_size);
+
 /**
  * Set display render mode
  * @param disp              pointer to a display
@@ -315,6 +332,13 @@ bool lv_display_get_antialiasing(lv_display_t * disp);
  */
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp);
 
+/**
+ * Same as `lv_display_flush_ready()` but can be called from an interrupt
+ * when a ring of buffers is used with an OS
+ * @param disp      pointer to display whose `flush_cb` was called
+ */
+LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready_isr(lv_display_t * disp);
+
 /**
  * Tell if it's the last area of the refreshing process.
  * Can be called from `flush_cb` to execute some special display refreshing if needed when all areas area flushed.
@@ -506,6 +530,33 @@ void lv_display_enable_invalidation(lv_display_t * disp, bool en);
  */
 bool lv_display_is_invalidation_enabled(lv_display_t * disp);
 
+#if LV_REFR_INV_TILE_SIZE
+/**
+ * Get how many pixels were not redrawn thanks to the invalidated tile map
+ * compared to refreshing the whole screen when all the `LV_INV_BUF_SIZE` areas are used.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the number of saved pixels since the display was created
+ */
+uint64_t lv_display_get_inv_tiles_saved_px(lv_display_t * disp);
+#endif
+
+#if LV_REFR_FLUSH_DIFF_SEG_W
+/**
+ * Get how many bytes were not flushed because the rendered rows and columns
+ * were the same as the ones flushed earlier.
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          the number of saved bytes since the display was created
+ */
+uint64_t lv_display_get_flush_diff_saved_bytes(lv_display_t * disp);
+
+/**
+ * Forget the content flushed earlier so that the next refreshes flush all the rendered pixels.
+ * Needs to be called if the content of the display was changed outside of LVGL.
+ * @param disp      pointer to a display (NULL to use the default display)
+ */
+void lv_display_reset_flush_diff(lv_display_t * disp);
+#endif
+
 /**
  * Get a pointer to the screen refresher timer to
  * modify its parameters with `lv_timer_...` functions.
@@ -86,6 +86,29 @@ struct lv_display_t {
     /** 1: It was the last chunk to flush. (It can't be a bit field because when it's cleared
      * from IRQ Read-Modify-Write issue might occur) */
     volatile int flushing_last;
+
+    /** Ring of draw buffers set by `lv_display_set_buffer_ring()`. `buf_1` and `buf_2` point to its first two elements*/
+    lv_draw_buf_t * buf_ring;
+    uint32_t buf_ring_cnt;          /**< Number of buffers in `buf_ring`. 0: no ring is used*/
+    uint32_t buf_ring_act;          /**< Index of `buf_act` in `buf_ring`*/
+
+    /** `flush_issued_cnt` after the last flush of each buffer in `buf_ring`.
+     * A buffer is free when `flush_ready_cnt` reaches it.*/
+    uint32_t * buf_ring_issued;
+
+    /** Number of `flush_cb` calls with a ring of buffers. Written only by the library*/
+    uint32_t flush_issued_cnt;
+
+    /** Number of completed flushes with a ring of buffers. Written only by `lv_display_flush_ready()`*/
+    volatile uint32_t flush_ready_cnt;
+
+    /** Number of `flush_wait_cb` returns without a `lv_display_flush_ready()` call with a ring of buffers.
+     * They are completed flushes too. Written only by the library*/
+    uint32_t flush_waited_cnt;
+
+#if LV_USE_OS
+    lv_thread_sync_t flush_sync;    /**< Signaled by `lv_display_flush_ready()` with a ring of buffers*/
+#endif
     volatile uint32_t last_area         : 1; /**< 1: last area is being rendered */
     volatile uint32_t last_part         : 1; /**< 1: last part of the current area is being rendered */
 
@@ -103,6 +126,21 @@ struct lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+#if LV_REFR_INV_TILE_SIZE
+    /** Invalidated tiles (1 bit per `LV_REFR_INV_TILE_SIZE` sized tile). Used when `inv_areas` is full*/
+    uint8_t * inv_tiles;
+    uint32_t inv_tiles_size;        /**< Size of `inv_tiles` in bytes*/
+    uint32_t inv_tiles_active : 1;  /**< 1: new invalidated areas are added to `inv_tiles`*/
+    uint64_t inv_tiles_saved_px;    /**< Pixels not redrawn compared to a full screen refresh*/
+#endif
+
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    /** Hash of each `LV_REFR_FLUSH_DIFF_SEG_W` wide segment of each row as it was last flushed. 0: unknown*/
+    uint32_t * flush_diff_hashes;
+    uint32_t flush_diff_seg_cnt;        /**< Number of segments in a row*/
+    uint64_t flush_diff_saved_bytes;    /**< Bytes not flushed as they were unchanged*/
+#endif
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
@@ -0,0 +1,406 @@
+/**
+ * @file lv_display_ring_test.c
+ *
+ * Test of the ring of buffers set by `lv_display_set_buffer_ring()` and of double buffering
+ * with a slow display.
+ * It's a standalone Linux program which is compiled only if `LV_DISPLAY_RING_TEST` is defined.
+ *
+ * Build it on a host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_DISPLAY_RING_TEST \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o ring_test
+ *
+ * Usage: `./ring_test [latency_us] [buf_cnt] [frame_cnt]`
+ *
+ * `flush_cb` only queues the areas and a separate thread copies them to a frame buffer
+ * after `latency_us`, like a DMA would do. If LVGL rendered into a buffer which is still being
+ * transferred, the frame buffer would be different from the one rendered with a single buffer.
+ * An object is redrawn in every frame without changes to test skipping the flush
+ * with `LV_REFR_FLUSH_DIFF_SEG_W` too.
+ * With double buffering the flushes are reported as ready by calling `lv_display_flush_ready()`
+ * from the thread. With the ring
+ * - by calling `lv_display_flush_ready()` from the thread,
+ * - by returning from `flush_wait_cb` without calling `lv_display_flush_ready()`,
+ * - or not at all as there is no `flush_cb`.
+ * A watchdog stops the program if a test hangs.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_DISPLAY_RING_TEST
+
+#include "../../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         240
+#define BUF_LINES       10
+#define BUF_CNT_MAX     8
+#define JOB_CNT         256         /*Must be larger than the number of flushes in flight*/
+#define TIMEOUT_S       30
+#define POOL_CNT        ((1024 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    READY_BY_CALL,
+    READY_BY_WAIT_CB,
+} ready_mode_t;
+
+typedef struct {
+    lv_area_t area;
+    uint8_t * px_map;
+} job_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void ui_create(void);
+static void ui_set_frame(uint32_t frame);
+static void render(uint32_t frame_cnt, uint32_t * hashes);
+static uint32_t test(uint32_t frame_cnt, const uint32_t * ref_hashes, uint32_t * hashes);
+static void flush_sync_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void flush_queue_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static void flush_wait_cb(lv_display_t * disp);
+static void * flush_thread(void * arg);
+static void flush_drain(void);
+static void copy_to_fb(const lv_area_t * area, const uint8_t * px_map);
+static uint32_t fb_hash(void);
+static void timeout_handler(int sig);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint16_t fb[HOR_RES * VER_RES];
+static uint8_t sync_buf[HOR_RES * BUF_LINES * 2];
+LV_ATTRIBUTE_MEM_ALIGN static uint8_t ring_bufs[BUF_CNT_MAX][HOR_RES * BUF_LINES * 2];
+
+static lv_display_t * disp;
+static lv_obj_t * label;
+static lv_obj_t * box;
+static lv_obj_t * bar;
+static lv_obj_t * list;
+static lv_obj_t * still;
+
+static pthread_mutex_t job_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t job_cond = PTHREAD_COND_INITIALIZER;
+static job_t jobs[JOB_CNT];
+static uint32_t job_head;           /*Next job to transfer*/
+static uint32_t job_tail;           /*Next free slot*/
+static uint32_t job_max_in_flight;
+static uint32_t wait_done;          /*Transferred jobs not yet consumed by `flush_wait_cb`*/
+static ready_mode_t ready_mode;
+static uint32_t latency_us;
+static const char * test_name;
+static uint32_t tick;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    latency_us = argc > 1 ? atoi(argv[1]) : 2000;
+    uint32_t buf_cnt = argc > 2 ? atoi(argv[2]) : 3;
+    uint32_t frame_cnt = argc > 3 ? atoi(argv[3]) : 60;
+    buf_cnt = LV_CLAMP(2, buf_cnt, BUF_CNT_MAX);
+
+    /*Print the results even if the watchdog stops the program*/
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    signal(SIGALRM, timeout_handler);
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    lv_tick_set_cb(tick_get_cb);
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    ui_create();
+
+    pthread_t thread;
+    pthread_create(&thread, NULL, flush_thread, NULL);
+
+    uint32_t * ref_hashes = malloc(frame_cnt * sizeof(uint32_t));
+    uint32_t * hashes = malloc(frame_cnt * sizeof(uint32_t));
+
+    /*The reference: a single buffer flushed immediately*/
+    test_name = "reference";
+    lv_display_set_buffers(disp, sync_buf, NULL, sizeof(sync_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_sync_cb);
+    render(frame_cnt, ref_hashes);
+
+    uint32_t fail_cnt = 0;
+    lv_display_set_flush_cb(disp, flush_queue_cb);
+
+    test_name = "double buffered";
+    ready_mode = READY_BY_CALL;
+    lv_display_set_buffers(disp, ring_bufs[0], ring_bufs[1], sizeof(ring_bufs[0]), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    if(test(frame_cnt, ref_hashes, hashes)) fail_cnt++;
+
+    void * bufs[BUF_CNT_MAX];
+    for(i = 0; i < buf_cnt; i++) bufs[i] = ring_bufs[i];
+    lv_display_set_buffer_ring(disp, bufs, buf_cnt, sizeof(ring_bufs[0]));
+
+    test_name = "lv_display_flush_ready";
+    ready_mode = READY_BY_CALL;
+    if(test(frame_cnt, ref_hashes, hashes)) fail_cnt++;
+
+    test_name = "flush_wait_cb";
+    ready_mode = READY_BY_WAIT_CB;
+    lv_display_set_flush_wait_cb(disp, flush_wait_cb);
+    if(test(frame_cnt, ref_hashes, hashes)) fail_cnt++;
+
+    /*Nothing is flushed so nothing should be waited for.
+     *Set the ring again to forget the flushes which were not waited by `flush_wait_cb`.*/
+    test_name = "no flush_cb";
+    lv_display_set_buffer_ring(disp, bufs, buf_cnt, sizeof(ring_bufs[0]));
+    lv_display_set_flush_cb(disp, NULL);
+    lv_display_set_flush_wait_cb(disp, NULL);
+    alarm(TIMEOUT_S);
+    for(i = 0; i < frame_cnt; i++) {
+        ui_set_frame(i);
+        lv_refr_now(disp);
+    }
+    alarm(0);
+    printf("%-24s ok\n", test_name);
+
+    printf("%s\n", fail_cnt ? "FAILED" : "PASSED");
+    return fail_cnt ? 1 : 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void ui_create(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+
+    label = lv_label_create(scr);
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 5);
+
+    box = lv_obj_create(scr);
+    lv_obj_set_size(box, 60, 60);
+    lv_obj_set_style_radius(box, 15, 0);
+    lv_obj_set_style_shadow_width(box, 10, 0);
+
+    bar = lv_bar_create(scr);
+    lv_obj_set_size(bar, 200, 15);
+    lv_obj_align(bar, LV_ALIGN_BOTTOM_MID, 0, -10);
+
+    list = lv_list_create(scr);
+    lv_obj_set_size(list, 120, 150);
+    lv_obj_align(list, LV_ALIGN_RIGHT_MID, -5, 0);
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_list_add_button(list, LV_SYMBOL_FILE, "Item");
+    }
+
+    /*Aligned to 32 px to cover whole segments with `LV_REFR_FLUSH_DIFF_SEG_W`*/
+    still = lv_obj_create(scr);
+    lv_obj_set_size(still, 32, 32);
+    lv_obj_set_pos(still, HOR_RES - 32, VER_RES - 32);
+}
+
+/**
+ * Set the UI to a state which depends only on the frame's index
+ */
+static void ui_set_frame(uint32_t frame)
+{
+    /*The elapsed time shouldn't depend on the latency (e.g. to hide the scrollbar the same way)*/
+    tick = frame * 33;
+    lv_label_set_text_fmt(label, "Frame %"LV_PRIu32, frame);
+    lv_obj_set_pos(box, 10 + (frame * 7) % 120, 30 + (frame * 5) % 120);
+    lv_obj_set_style_bg_color(box, lv_color_hex(0x123456 * (frame + 1)), 0);
+
+    /*Redraw it without any change between the changed areas*/
+    lv_obj_invalidate(still);
+
+    lv_bar_set_value(bar, frame % 100, LV_ANIM_OFF);
+    lv_obj_scroll_to_y(list, (frame * 13) % 400, LV_ANIM_OFF);
+}
+
+/**
+ * Render the frames from the same initial state
+ * @param frame_cnt     number of frames to render
+ * @param hashes        store the hash of the frame buffer after each frame here
+ */
+static void render(uint32_t frame_cnt, uint32_t * hashes)
+{
+    memset(fb, 0, sizeof(fb));
+#if LV_REFR_FLUSH_DIFF_SEG_W
+    /*The frame buffer was cleared so nothing can be skipped*/
+    lv_display_reset_flush_diff(disp);
+#endif
+    ui_set_frame(0);
+    lv_obj_invalidate(lv_screen_active());
+
+    alarm(TIMEOUT_S);
+    uint32_t i;
+    for(i = 0; i < frame_cnt; i++) {
+        ui_set_frame(i);
+        lv_refr_now(disp);
+        flush_drain();
+        hashes[i] = fb_hash();
+    }
+    alarm(0);
+}
+
+/**
+ * Render the frames with the current buffers and compare them with the reference
+ * @param frame_cnt     number of frames to render
+ * @param ref_hashes    hashes of the frames rendered with a single buffer
+ * @param hashes        buffer for the hashes of the frames
+ * @return              number of different frames
+ */
+static uint32_t test(uint32_t frame_cnt, const uint32_t * ref_hashes, uint32_t * hashes)
+{
+    job_max_in_flight = 0;
+    double t_start = now_ms();
+    render(frame_cnt, hashes);
+    double t_render = now_ms() - t_start;
+
+    uint32_t diff_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < frame_cnt; i++) {
+        if(hashes[i] != ref_hashes[i]) diff_cnt++;
+    }
+
+    printf("%-24s different frames: %"LV_PRIu32", max in flight: %"LV_PRIu32", %.3f ms/frame\n",
+           test_name, diff_cnt, job_max_in_flight, t_render / frame_cnt);
+
+    return diff_cnt;
+}
+
+static void flush_sync_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    copy_to_fb(area, px_map);
+    lv_display_flush_ready(d);
+}
+
+static void flush_queue_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(d);
+
+    pthread_mutex_lock(&job_mutex);
+    jobs[job_tail % JOB_CNT].area = *area;
+    jobs[job_tail % JOB_CNT].px_map = px_map;
+    job_tail++;
+    job_max_in_flight = LV_MAX(job_max_in_flight, job_tail - job_head);
+    pthread_cond_broadcast(&job_cond);
+    pthread_mutex_unlock(&job_mutex);
+}
+
+static void flush_wait_cb(lv_display_t * d)
+{
+    LV_UNUSED(d);
+
+    pthread_mutex_lock(&job_mutex);
+    while(wait_done == 0) pthread_cond_wait(&job_cond, &job_mutex);
+    wait_done--;
+    pthread_mutex_unlock(&job_mutex);
+}
+
+/**
+ * Transfer the queued areas one by one like a slow display
+ */
+static void * flush_thread(void * arg)
+{
+    LV_UNUSED(arg);
+
+    while(1) {
+        pthread_mutex_lock(&job_mutex);
+        while(job_head == job_tail) pthread_cond_wait(&job_cond, &job_mutex);
+        job_t job = jobs[job_head % JOB_CNT];
+        pthread_mutex_unlock(&job_mutex);
+
+        usleep(latency_us);
+        copy_to_fb(&job.area, job.px_map);
+
+        pthread_mutex_lock(&job_mutex);
+        job_head++;
+        if(ready_mode == READY_BY_CALL) lv_display_flush_ready(disp);
+        else wait_done++;
+        pthread_cond_broadcast(&job_cond);
+        pthread_mutex_unlock(&job_mutex);
+    }
+
+    return NULL;
+}
+
+/**
+ * Wait until all the queued areas are transferred
+ */
+static void flush_drain(void)
+{
+    pthread_mutex_lock(&job_mutex);
+    while(job_head != job_tail) pthread_cond_wait(&job_cond, &job_mutex);
+    pthread_mutex_unlock(&job_mutex);
+}
+
+static void copy_to_fb(const lv_area_t * area, const uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&fb[y * HOR_RES + area->x1], px_map, w * 2);
+        px_map += w * 2;
+    }
+}
+
+static uint32_t fb_hash(void)
+{
+    /*FNV-1a*/
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        hash = (hash ^ fb[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+static void timeout_handler(int sig)
+{
+    LV_UNUSED(sig);
+    /*Only async-signal-safe functions can be used here*/
+    static const char msg[] = "Timeout, the rendering hung: ";
+    if(write(STDOUT_FILENO, msg, sizeof(msg) - 1) < 0) _exit(2);
+    if(write(STDOUT_FILENO, test_name, strlen(test_name)) < 0) _exit(2);
+    if(write(STDOUT_FILENO, "\n", 1) < 0) _exit(2);
+    _exit(2);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return tick;
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_DISPLAY_RING_TEST*/
@@ -23,14 +23,35 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Max. number of opaque areas to check the draw tasks against during culling*/
+#define CULL_OCCLUDER_MAX   8
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_CULL_TASK_CNT
+typedef struct {
+    lv_area_t area;     /**< This area will be fully covered*/
+    uint32_t index;     /**< Index of the draw task covering it in the culled batch*/
+} cull_occluder_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+    static void dep_grid_add_task(lv_layer_t * layer, lv_draw_task_t * t);
+    static void dep_grid_remove_task(lv_layer_t * layer, lv_draw_task_t * t);
+    static void dep_grid_drop(lv_layer_t * layer);
+#endif
+#if LV_DRAW_CULL_TASK_CNT
+    static void cull_tasks(lv_layer_t * layer, lv_draw_task_t * t_first);
+    static bool cull_get_opaque_area(const lv_draw_task_t * t, lv_area_t * area);
+    static bool cull_clip_area(lv_area_t * area, const lv_area_t * occluder);
+    static bool cull_is_transformed(const lv_draw_task_t * t);
+#endif
 
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
 {
@@ -123,6 +144,11 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
 
     lv_draw_global_info_t * info = &_draw_info;
 
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+    /*Find the older tasks overlapping this one before any newer tasks can be added in the event*/
+    if(info->unit_cnt > 1) dep_grid_add_task(layer, t);
+#endif
+
     /*Send LV_EVENT_DRAW_TASK_ADDED and dispatch only on the "main" draw_task
      *and not on the draw tasks added in the event.
      *Sending LV_EVENT_DRAW_TASK_ADDED events might cause recursive event sends and besides
@@ -144,6 +170,21 @@ void lv_draw_finalize_task_creation(lv_layer_t * layer, lv_draw_task_t * t)
             u = u->next;
         }
 
+#if LV_DRAW_CULL_TASK_CNT
+        /*Collect a few draw tasks so that the ones covered by a later draw task can be culled
+         *before dispatching them. Layers are dispatched immediately to not keep more layers in the memory.*/
+        if(t->type != LV_DRAW_TASK_TYPE_LAYER) {
+            if(layer->cull_first == NULL) layer->cull_first = t;
+            layer->cull_cnt++;
+            if(layer->cull_cnt < LV_DRAW_CULL_TASK_CNT) {
+                /*Let the dispatch loops waiting for a request run*/
+                lv_draw_dispatch_request();
+                LV_PROFILER_END;
+                return;
+            }
+        }
+#endif
+
         lv_draw_dispatch();
     }
     else {
@@ -195,6 +236,16 @@ void lv_draw_dispatch(void)
 bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
 {
     LV_PROFILER_BEGIN;
+#if LV_DRAW_CULL_TASK_CNT
+    /*Cull the collected draw tasks before any of them is dispatched.
+     *The culled ones are set to ready and removed below.*/
+    if(layer->cull_first) {
+        cull_tasks(layer, layer->cull_first);
+        layer->cull_first = NULL;
+        layer->cull_cnt = 0;
+    }
+#endif
+
     /*Remove the finished tasks first*/
     lv_draw_task_t * t_prev = NULL;
     lv_draw_task_t * t = layer->draw_task_head;
@@ -240,6 +291,9 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
                 draw_label_dsc->text = NULL;
             }
 
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+            dep_grid_remove_task(layer, t);
+#endif
             lv_free(t->draw_dsc);
             lv_free(t);
         }
@@ -249,6 +303,14 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+    /*All the tasks are removed so the grid is empty. Free it as the layer might not be used anymore.*/
+    if(layer->draw_task_head == NULL && layer->dep_grid) {
+        lv_free(layer->dep_grid);
+        layer->dep_grid = NULL;
+    }
+#endif
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -473,6 +535,18 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
     *area = t->area;
 }
 
+#if LV_DRAW_CULL_TASK_CNT
+void lv_draw_get_cull_stat(lv_draw_cull_stat_t * stat)
+{
+    *stat = _draw_info.cull_stat;
+}
+
+void lv_draw_reset_cull_stat(void)
+{
+    lv_memzero(&_draw_info.cull_stat, sizeof(lv_draw_cull_stat_t));
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -485,6 +559,11 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
  */
 static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 {
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+    /*The overlapping older tasks are already counted*/
+    if(layer->dep_grid) return t_check->dep_cnt == 0;
+#endif
+
     LV_PROFILER_BEGIN;
     lv_draw_task_t * t = layer->draw_task_head;
 
@@ -503,3 +582,355 @@ static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
 
     return true;
 }
+
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+
+/**
+ * Register a new draw task in the dependency grid of its layer.
+ * The last not ready draw task of every touched cell will be a dependency of the new task.
+ * @param layer     the layer of the draw task
+ * @param t         the newly added draw task (the last task in the layer)
+ */
+static void dep_grid_add_task(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    LV_PROFILER_BEGIN_TAG("dep_grid_add_task");
+
+    /*Mark that no cells are touched*/
+    t->dep_cells.x1 = 0;
+    t->dep_cells.y1 = 0;
+    t->dep_cells.x2 = -1;
+    t->dep_cells.y2 = -1;
+
+    /*Create the grid only for the first task as the dependencies
+     *of the new tasks can't be known if the older tasks are not in the grid*/
+    if(layer->draw_task_head == t) {
+        uint32_t cols = (lv_area_get_width(&layer->buf_area) + LV_DRAW_TASK_DEP_CELL_SIZE - 1) / LV_DRAW_TASK_DEP_CELL_SIZE;
+        uint32_t rows = (lv_area_get_height(&layer->buf_area) + LV_DRAW_TASK_DEP_CELL_SIZE - 1) / LV_DRAW_TASK_DEP_CELL_SIZE;
+        if(layer->dep_grid && cols * rows != layer->dep_grid_cols * layer->dep_grid_rows) {
+            lv_free(layer->dep_grid);
+            layer->dep_grid = NULL;
+        }
+
+        if(layer->dep_grid == NULL) {
+            layer->dep_grid = lv_malloc_zeroed(cols * rows * sizeof(lv_draw_task_t *));
+            if(layer->dep_grid == NULL) {
+                LV_LOG_WARN("Couldn't allocate the dependency grid, compare the draw tasks one by one");
+                LV_PROFILER_END_TAG("dep_grid_add_task");
+                return;
+            }
+        }
+
+        layer->dep_grid_area = layer->buf_area;
+        layer->dep_grid_cols = cols;
+        layer->dep_grid_rows = rows;
+    }
+
+    if(layer->dep_grid == NULL) {
+        LV_PROFILER_END_TAG("dep_grid_add_task");
+        return;
+    }
+
+    lv_area_t a;
+    if(!lv_area_intersect(&a, &t->_real_area, &layer->dep_grid_area)) {
+        LV_PROFILER_END_TAG("dep_grid_add_task");
+        return;
+    }
+
+    t->dep_cells.x1 = (a.x1 - layer->dep_grid_area.x1) / LV_DRAW_TASK_DEP_CELL_SIZE;
+    t->dep_cells.y1 = (a.y1 - layer->dep_grid_area.y1) / LV_DRAW_TASK_DEP_CELL_SIZE;
+    t->dep_cells.x2 = (a.x2 - layer->dep_grid_area.x1) / LV_DRAW_TASK_DEP_CELL_SIZE;
+    t->dep_cells.y2 = (a.y2 - layer->dep_grid_area.y1) / LV_DRAW_TASK_DEP_CELL_SIZE;
+
+    int32_t x;
+    int32_t y;
+    for(y = t->dep_cells.y1; y <= t->dep_cells.y2; y++) {
+        lv_draw_task_t ** cell = &layer->dep_grid[y * layer->dep_grid_cols + t->dep_cells.x1];
+        for(x = t->dep_cells.x1; x <= t->dep_cells.x2; x++, cell++) {
+            lv_draw_task_t * t_old = *cell;
+            *cell = t;
+
+            /*The older tasks of this cell are dependencies of `t_old` so it's enough to depend on it.
+             *If it was added as a dependency in an other cell it's the last item in its dependents*/
+            if(t_old == NULL || t_old->state == LV_DRAW_TASK_STATE_READY) continue;
+            if(t_old->dependent_cnt && t_old->dependents[t_old->dependent_cnt - 1] == t) continue;
+
+            if(t_old->dependent_cnt == t_old->dependent_size) {
+                uint32_t new_size = t_old->dependent_size ? t_old->dependent_size * 2 : 4;
+                lv_draw_task_t ** new_dependents = lv_realloc(t_old->dependents, new_size * sizeof(lv_draw_task_t *));
+                if(new_dependents == NULL) {
+                    /*Without the grid `is_independent()` compares the tasks one by one*/
+                    LV_LOG_WARN("Couldn't store a dependency, compare the draw tasks one by one");
+                    dep_grid_drop(layer);
+                    LV_PROFILER_END_TAG("dep_grid_add_task");
+                    return;
+                }
+                t_old->dependents = new_dependents;
+                t_old->dependent_size = new_size;
+            }
+
+            t_old->dependents[t_old->dependent_cnt] = t;
+            t_old->dependent_cnt++;
+            t->dep_cnt++;
+        }
+    }
+
+    LV_PROFILER_END_TAG("dep_grid_add_task");
+}
+
+/**
+ * Remove a ready draw task from the dependency grid and release the tasks depending on it.
+ * @param layer     the layer of the draw task
+ * @param t         the draw task to remove
+ */
+static void dep_grid_remove_task(lv_layer_t * layer, lv_draw_task_t * t)
+{
+    uint32_t i;
+    for(i = 0; i < t->dependent_cnt; i++) {
+        t->dependents[i]->dep_cnt--;
+    }
+    lv_free(t->dependents);
+    t->dependents = NULL;
+    t->dependent_cnt = 0;
+
+    if(layer->dep_grid == NULL) return;
+
+    int32_t x;
+    int32_t y;
+    for(y = t->dep_cells.y1; y <= t->dep_cells.y2; y++) {
+        lv_draw_task_t ** cell = &layer->dep_grid[y * layer->dep_grid_cols + t->dep_cells.x1];
+        for(x = t->dep_cells.x1; x <= t->dep_cells.x2; x++, cell++) {
+            if(*cell == t) *cell = NULL;
+        }
+    }
+}
+
+/**
+ * Free the dependency grid of a layer and forget the dependencies of its draw tasks.
+ * Without the grid the tasks can be removed in any order so the dependencies can't be kept.
+ * @param layer     the layer whose grid should be dropped
+ */
+static void dep_grid_drop(lv_layer_t * layer)
+{
+    lv_free(layer->dep_grid);
+    layer->dep_grid = NULL;
+
+    lv_draw_task_t * t = layer->draw_task_head;
+    while(t) {
+        lv_free(t->dependents);
+        t->dependents = NULL;
+        t->dependent_cnt = 0;
+        t->dependent_size = 0;
+        t->dep_cnt = 0;
+        t->dep_cells.x1 = 0;
+        t->dep_cells.y1 = 0;
+        t->dep_cells.x2 = -1;
+        t->dep_cells.y2 = -1;
+        t = t->next;
+    }
+}
+
+#endif /*LV_DRAW_TASK_DEP_CELL_SIZE*/
+
+#if LV_DRAW_CULL_TASK_CNT
+
+/**
+ * Drop the fill, border, shadow and image draw tasks which are fully covered by a later opaque
+ * draw task and reduce the clip area of the ones whose side is covered.
+ * @param layer     the layer of the draw tasks
+ * @param t_first   the first not dispatched draw task. It and all the later tasks are still queued.
+ */
+static void cull_tasks(lv_layer_t * layer, lv_draw_task_t * t_first)
+{
+    LV_UNUSED(layer);
+    LV_PROFILER_BEGIN;
+
+    /*Collect the largest opaque areas*/
+    cull_occluder_t occluders[CULL_OCCLUDER_MAX];
+    uint32_t occluder_cnt = 0;
+    uint32_t i = 0;
+    lv_draw_task_t * t;
+    for(t = t_first; t; t = t->next, i++) {
+        lv_area_t a;
+        if(!cull_get_opaque_area(t, &a)) continue;
+
+        uint32_t k = occluder_cnt;
+        if(occluder_cnt < CULL_OCCLUDER_MAX) {
+            occluder_cnt++;
+        }
+        else {
+            /*Replace the smallest one if the new one is larger*/
+            uint32_t j;
+            k = 0;
+            for(j = 1; j < CULL_OCCLUDER_MAX; j++) {
+                if(lv_area_get_size(&occluders[j].area) < lv_area_get_size(&occluders[k].area)) k = j;
+            }
+            if(lv_area_get_size(&occluders[k].area) >= lv_area_get_size(&a)) continue;
+        }
+
+        occluders[k].area = a;
+        occluders[k].index = i;
+    }
+
+    lv_draw_cull_stat_t * stat = &_draw_info.cull_stat;
+    i = 0;
+    for(t = t_first; t; t = t->next, i++) {
+        if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_BORDER &&
+           t->type != LV_DRAW_TASK_TYPE_BOX_SHADOW && t->type != LV_DRAW_TASK_TYPE_IMAGE) continue;
+        if(cull_is_transformed(t)) continue;
+
+        lv_area_t visible;
+        if(!lv_area_intersect(&visible, &t->_real_area, &t->clip_area)) continue;
+
+        uint32_t px_cnt = lv_area_get_size(&visible);
+        stat->task_cnt++;
+        stat->px_cnt += px_cnt;
+
+        /*With the dependency grid the older tasks of a ready task are assumed to be ready too.
+         *So only a task without unfinished dependencies can be dropped.*/
+        bool droppable = true;
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+        if(layer->dep_grid && t->dep_cnt) droppable = false;
+#endif
+
+        bool covered = false;
+        bool clipped = false;
+        uint32_t j;
+        for(j = 0; j < occluder_cnt; j++) {
+            /*Only the later draw tasks can cover*/
+            if(occluders[j].index <= i) continue;
+
+            if(lv_area_is_in(&visible, &occluders[j].area, 0)) {
+                covered = true;
+                break;
+            }
+
+            if(cull_clip_area(&visible, &occluders[j].area)) clipped = true;
+        }
+
+        if(covered && droppable) {
+            t->state = LV_DRAW_TASK_STATE_READY;
+            stat->dropped_cnt++;
+            stat->px_culled_cnt += px_cnt;
+        }
+        else if(clipped && !covered) {
+            /*Nothing is drawn outside of the real area so it's safe to clip to it*/
+            t->clip_area = visible;
+            stat->clipped_cnt++;
+            stat->px_culled_cnt += px_cnt - lv_area_get_size(&visible);
+        }
+    }
+
+    LV_PROFILER_END;
+}
+
+/**
+ * Get the area which will be fully covered by a draw task
+ * @param t         a draw task
+ * @param area      store the covered area here
+ * @return          true: the draw task is opaque and `area` is valid
+ */
+static bool cull_get_opaque_area(const lv_draw_task_t * t, lv_area_t * area)
+{
+    if(cull_is_transformed(t)) return false;
+
+    if(t->type == LV_DRAW_TASK_TYPE_FILL) {
+        const lv_draw_fill_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+
+        /*The complex gradients might not cover the whole area*/
+        const lv_grad_dsc_t * grad = &dsc->grad;
+        if(grad->dir != LV_GRAD_DIR_NONE) {
+            if(grad->dir != LV_GRAD_DIR_VER && grad->dir != LV_GRAD_DIR_HOR) return false;
+            uint32_t i;
+            for(i = 0; i < grad->stops_count; i++) {
+                if(grad->stops[i].opa < LV_OPA_MAX) return false;
+            }
+        }
+
+        /*Take the larger of the horizontal and vertical "cross" of a rounded rectangle.
+         *Shrink with one more pixel to be sure that the anti-aliased pixels are excluded.*/
+        *area = t->area;
+        if(dsc->radius > 0) {
+            int32_t short_side = LV_MIN(lv_area_get_width(area), lv_area_get_height(area));
+            int32_t r = LV_MIN(dsc->radius, short_side / 2) + 1;
+            if(lv_area_get_width(area) >= lv_area_get_height(area)) lv_area_increase(area, 0, -r);
+            else lv_area_increase(area, -r, 0);
+        }
+    }
+    else if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        const lv_draw_image_dsc_t * dsc = t->draw_dsc;
+        if(dsc->opa < LV_OPA_MAX) return false;
+        if(dsc->blend_mode != LV_BLEND_MODE_NORMAL) return false;
+        if(dsc->rotation != 0 || dsc->skew_x != 0 || dsc->skew_y != 0) return false;
+        if(dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE) return false;
+        if(dsc->tile || dsc->clip_radius != 0 || dsc->bitmap_mask_src) return false;
+
+        lv_color_format_t cf = dsc->header.cf;
+        if(cf == LV_COLOR_FORMAT_UNKNOWN || cf == LV_COLOR_FORMAT_RAW || lv_color_format_has_alpha(cf)) return false;
+
+        /*The image needs to fill its area*/
+        if(lv_area_get_width(&dsc->image_area) != dsc->header.w ||
+           lv_area_get_height(&dsc->image_area) != dsc->header.h) return false;
+
+        if(!lv_area_intersect(area, &t->area, &dsc->image_area)) return false;
+    }
+    else {
+        return false;
+    }
+
+    return lv_area_intersect(area, area, &t->clip_area);
+}
+
+/**
+ * Cut the side of an area which is covered by an other area
+ * @param area      the area to reduce
+ * @param occluder  the covering area
+ * @return          true: `area` was changed
+ */
+static bool cull_clip_area(lv_area_t * area, const lv_area_t * occluder)
+{
+    /*Covers the full width, cut from the top or bottom*/
+    if(occluder->x1 <= area->x1 && occluder->x2 >= area->x2) {
+        if(occluder->y1 <= area->y1 && occluder->y2 >= area->y1) {
+            area->y1 = occluder->y2 + 1;
+            return true;
+        }
+        if(occluder->y2 >= area->y2 && occluder->y1 <= area->y2) {
+            area->y2 = occluder->y1 - 1;
+            return true;
+        }
+    }
+
+    /*Covers the full height, cut from the left or right*/
+    if(occluder->y1 <= area->y1 && occluder->y2 >= area->y2) {
+        if(occluder->x1 <= area->x1 && occluder->x2 >= area->x1) {
+            area->x1 = occluder->x2 + 1;
+            return true;
+        }
+        if(occluder->x2 >= area->x2 && occluder->x1 <= area->x2) {
+            area->x2 = occluder->x1 - 1;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Check if the areas of a draw task are not the drawn areas as it's transformed by a matrix
+ * @param t         a draw task
+ * @return          true: the draw task can't be culled
+ */
+static bool cull_is_transformed(const lv_draw_task_t * t)
+{
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_t identity;
+    lv_matrix_identity(&identity);
+    return lv_memcmp(&t->matrix, &identity, sizeof(lv_matrix_t)) != 0;
+#else
+    LV_UNUSED(t);
+    return false;
+#endif
+}
+
+#endif /*LV_DRAW_CULL_TASK_CNT*/
@@ -25,6 +25,7 @@ extern "C" {
 #include "../misc/lv_profiler.h"
 #include "../misc/lv_matrix.h"
 #include "lv_image_decoder.h"
+#include "lv_image_prefetch.h"
 #include "../osal/lv_os.h"
 #include "lv_draw_buf.h"
 
@@ -105,6 +106,22 @@ struct lv_layer_t  {
     lv_layer_t * next;
     bool all_tasks_added;
     void * user_data;
+
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+    /** The last draw task touching each cell of a grid over `dep_grid_area`.
+     * Used to find the dependencies of new draw tasks. NULL if the dependencies are not tracked.*/
+    lv_draw_task_t ** dep_grid;
+    lv_area_t dep_grid_area;
+    uint32_t dep_grid_cols;
+    uint32_t dep_grid_rows;
+#endif
+
+#if LV_DRAW_CULL_TASK_CNT
+    /** The first draw task which is not dispatched yet and the number of such draw tasks.
+     * They are checked for culling before they are dispatched.*/
+    lv_draw_task_t * cull_first;
+    uint32_t cull_cnt;
+#endif
 };
 
 typedef struct {
@@ -117,6 +134,16 @@ typedef struct {
     void * user_data;
 } lv_draw_dsc_base_t;
 
+#if LV_DRAW_CULL_TASK_CNT
+typedef struct {
+    uint32_t task_cnt;          /**< Number of draw tasks checked for culling*/
+    uint32_t dropped_cnt;       /**< Number of draw tasks dropped as they were fully covered*/
+    uint32_t clipped_cnt;       /**< Number of draw tasks whose clip area was reduced*/
+    uint64_t px_cnt;            /**< Pixels the checked draw tasks would have drawn*/
+    uint64_t px_culled_cnt;     /**< Pixels which were not drawn thanks to the culling*/
+} lv_draw_cull_stat_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -211,6 +238,20 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
  */
 uint32_t lv_draw_get_dependent_count(lv_draw_task_t * t_check);
 
+#if LV_DRAW_CULL_TASK_CNT
+/**
+ * Get the statistics of the draw task culling.
+ * `px_cnt / (px_cnt - px_culled_cnt)` shows how much overdraw was saved.
+ * @param stat      store the statistics here
+ */
+void lv_draw_get_cull_stat(lv_draw_cull_stat_t * stat);
+
+/**
+ * Reset the statistics of the draw task culling
+ */
+void lv_draw_reset_cull_stat(void);
+#endif
+
 /**
  * Create a new layer on a parent layer
  * @param parent_layer      the parent layer to which the layer will be merged when it's rendered
@@ -19,6 +19,7 @@
 #define default_handlers LV_GLOBAL_DEFAULT()->draw_buf_handlers
 #define font_draw_buf_handlers LV_GLOBAL_DEFAULT()->font_draw_buf_handlers
 #define image_cache_draw_buf_handlers LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers
+#define draw_buf_pool LV_GLOBAL_DEFAULT()->draw_buf_pool
 
 /**********************
  *      TYPEDEFS
@@ -36,6 +37,13 @@ static void draw_buf_free(const lv_draw_buf_handlers_t * handler, void * buf);
 static uint32_t width_to_stride(uint32_t w, lv_color_format_t color_format);
 static uint32_t _calculate_draw_buf_size(uint32_t w, uint32_t h, lv_color_format_t cf, uint32_t stride);
 static void draw_buf_get_full_area(const lv_draw_buf_t * draw_buf, lv_area_t * full_area);
+#if LV_DRAW_BUF_POOL_SIZE
+    static void * pool_malloc(size_t size);
+    static void pool_free(void * buf);
+    static size_t pool_round_size(size_t size);
+    static void pool_lock(void);
+    static void pool_unlock(void);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -54,6 +62,20 @@ void lv_draw_buf_init_handlers(void)
     lv_draw_buf_init_with_default_handlers(&default_handlers);
     lv_draw_buf_init_with_default_handlers(&font_draw_buf_handlers);
     lv_draw_buf_init_with_default_handlers(&image_cache_draw_buf_handlers);
+
+#if LV_DRAW_BUF_POOL_SIZE && LV_USE_OS
+    lv_mutex_init(&draw_buf_pool.lock);
+#endif
+}
+
+void lv_draw_buf_deinit_handlers(void)
+{
+#if LV_DRAW_BUF_POOL_SIZE
+    lv_draw_buf_pool_drop();
+#if LV_USE_OS
+    lv_mutex_delete(&draw_buf_pool.lock);
+#endif
+#endif
 }
 
 void lv_draw_buf_init_with_default_handlers(lv_draw_buf_handlers_t * handlers)
@@ -93,6 +115,32 @@ lv_draw_buf_handlers_t * lv_draw_buf_get_image_handlers(void)
     return &image_cache_draw_buf_handlers;
 }
 
+#if LV_DRAW_BUF_POOL_SIZE
+void lv_draw_buf_pool_get_stat(lv_draw_buf_pool_stat_t * stat)
+{
+    LV_ASSERT_NULL(stat);
+
+    pool_lock();
+    *stat = draw_buf_pool.stat;
+    pool_unlock();
+}
+
+void lv_draw_buf_pool_drop(void)
+{
+    pool_lock();
+    lv_draw_buf_pool_block_t * block = draw_buf_pool.free_list;
+    draw_buf_pool.free_list = NULL;
+    draw_buf_pool.stat.pooled = 0;
+    pool_unlock();
+
+    while(block) {
+        lv_draw_buf_pool_block_t * next = block->next;
+        lv_free(block);
+        block = next;
+    }
+}
+#endif
+
 uint32_t lv_draw_buf_width_to_stride(uint32_t w, lv_color_format_t color_format)
 {
     return lv_draw_buf_width_to_stride_ex(&default_handlers, w, color_format);
@@ -600,12 +648,20 @@ static void * buf_malloc(size_t size_bytes, lv_color_format_t color_format)
 
     /*Allocate larger memory to be sure it can be aligned as needed*/
     size_bytes += LV_DRAW_BUF_ALIGN - 1;
+#if LV_DRAW_BUF_POOL_SIZE
+    return pool_malloc(size_bytes);
+#else
     return lv_malloc(size_bytes);
+#endif
 }
 
 static void buf_free(void * buf)
 {
+#if LV_DRAW_BUF_POOL_SIZE
+    pool_free(buf);
+#else
     lv_free(buf);
+#endif
 }
 
 static void * buf_align(void * buf, lv_color_format_t color_format)
@@ -667,3 +723,96 @@ static void draw_buf_get_full_area(const lv_draw_buf_t * draw_buf, lv_area_t * f
     const lv_image_header_t * header = &draw_buf->header;
     lv_area_set(full_area, 0, 0, header->w - 1, header->h - 1);
 }
+
+#if LV_DRAW_BUF_POOL_SIZE
+
+static void * pool_malloc(size_t size)
+{
+    size = pool_round_size(size);
+
+    /*Reuse a freed block of the same size class*/
+    pool_lock();
+    lv_draw_buf_pool_block_t * block = draw_buf_pool.free_list;
+    lv_draw_buf_pool_block_t * prev = NULL;
+    while(block && block->size != size) {
+        prev = block;
+        block = block->next;
+    }
+
+    bool reused = block != NULL;
+    if(reused) {
+        if(prev) prev->next = block->next;
+        else draw_buf_pool.free_list = block->next;
+        draw_buf_pool.stat.pooled -= size;
+    }
+    pool_unlock();
+
+    if(!reused) {
+        block = lv_malloc(sizeof(lv_draw_buf_pool_block_t) + size);
+        /*The pooled blocks might be in the way, so free them and try again*/
+        if(block == NULL) {
+            lv_draw_buf_pool_drop();
+            block = lv_malloc(sizeof(lv_draw_buf_pool_block_t) + size);
+        }
+        if(block == NULL) return NULL;
+
+        block->size = size;
+    }
+
+    pool_lock();
+    if(reused) draw_buf_pool.stat.reused++;
+    else draw_buf_pool.stat.missed++;
+    draw_buf_pool.stat.in_use += size;
+    if(draw_buf_pool.stat.in_use > draw_buf_pool.stat.peak) draw_buf_pool.stat.peak = draw_buf_pool.stat.in_use;
+    pool_unlock();
+
+    return block + 1;
+}
+
+static void pool_free(void * buf)
+{
+    if(buf == NULL) return;
+
+    lv_draw_buf_pool_block_t * block = (lv_draw_buf_pool_block_t *)buf - 1;
+
+    pool_lock();
+    draw_buf_pool.stat.in_use -= block->size;
+    if(block->size <= LV_DRAW_BUF_POOL_SIZE - draw_buf_pool.stat.pooled) {
+        block->next = draw_buf_pool.free_list;
+        draw_buf_pool.free_list = block;
+        draw_buf_pool.stat.pooled += block->size;
+        block = NULL;
+    }
+    pool_unlock();
+
+    /*The pool is full*/
+    if(block) lv_free(block);
+}
+
+/**
+ * Round up the size to 1/4 steps between the powers of 2
+ * so that buffers of similar sizes can replace each other with at most 25% waste.
+ */
+static size_t pool_round_size(size_t size)
+{
+    size_t step = 16;
+    while(step * 8 <= size) step <<= 1;
+
+    return LV_ROUND_UP(size, step);
+}
+
+static void pool_lock(void)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&draw_buf_pool.lock);
+#endif
+}
+
+static void pool_unlock(void)
+{
+#if LV_USE_OS
+    lv_mutex_unlock(&draw_buf_pool.lock);
+#endif
+}
+
+#endif /*LV_DRAW_BUF_POOL_SIZE*/
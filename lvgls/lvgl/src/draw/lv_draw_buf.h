@@ -85,6 +85,16 @@ typedef void (*lv_draw_buf_cache_operation_cb)(const lv_draw_buf_t * draw_buf, c
 
 typedef uint32_t (*lv_draw_buf_width_to_stride_cb)(uint32_t w, lv_color_format_t color_format);
 
+#if LV_DRAW_BUF_POOL_SIZE
+typedef struct {
+    uint32_t in_use;    /**< Bytes of the draw buffers allocated now*/
+    uint32_t peak;      /**< The max. of `in_use` since `lv_init()`*/
+    uint32_t pooled;    /**< Bytes of the freed draw buffers kept for reuse*/
+    uint32_t reused;    /**< Number of allocations served from the pool*/
+    uint32_t missed;    /**< Number of allocations served from the heap*/
+} lv_draw_buf_pool_stat_t;
+#endif
+
 struct lv_draw_buf_t {
     lv_image_header_t header;
     uint32_t data_size;       /**< Total buf size in bytes */
@@ -132,6 +142,19 @@ lv_draw_buf_handlers_t * lv_draw_buf_get_handlers(void);
 lv_draw_buf_handlers_t * lv_draw_buf_get_font_handlers(void);
 lv_draw_buf_handlers_t * lv_draw_buf_get_image_handlers(void);
 
+#if LV_DRAW_BUF_POOL_SIZE
+/**
+ * Get the memory usage of the draw buffers allocated by the default handlers.
+ * @param stat      store the statistics here
+ */
+void lv_draw_buf_pool_get_stat(lv_draw_buf_pool_stat_t * stat);
+
+/**
+ * Free all the draw buffers kept for reuse in the pool
+ */
+void lv_draw_buf_pool_drop(void);
+#endif
+
 
 /**
  * Align the address of a buffer. The buffer needs to be large enough for the real data after alignment
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_buf.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -33,6 +34,22 @@ struct lv_draw_buf_handlers_t {
     lv_draw_buf_width_to_stride_cb width_to_stride_cb;
 };
 
+#if LV_DRAW_BUF_POOL_SIZE
+/** Header in front of the buffers allocated by the draw buffer pool*/
+typedef struct lv_draw_buf_pool_block_t {
+    struct lv_draw_buf_pool_block_t * next;     /**< Next free block while it's in the pool*/
+    size_t size;                                /**< Size of the block without this header*/
+} lv_draw_buf_pool_block_t;
+
+typedef struct {
+    lv_draw_buf_pool_block_t * free_list;       /**< The freed blocks kept for reuse, the latest first*/
+    lv_draw_buf_pool_stat_t stat;
+#if LV_USE_OS
+    lv_mutex_t lock;
+#endif
+} lv_draw_buf_pool_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -42,6 +59,11 @@ struct lv_draw_buf_handlers_t {
  */
 void lv_draw_buf_init_handlers(void);
 
+/**
+ * Called internally to free the buffers kept by the draw buffer pool
+ */
+void lv_draw_buf_deinit_handlers(void);
+
 /**********************
  *      MACROS
  **********************/
@@ -20,6 +20,7 @@
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 #include "../core/lv_global.h"
+#include "../font/lv_font_glyph_cache.h"
 
 /*********************
  *      DEFINES
@@ -38,6 +39,10 @@
  **********************/
 static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,  const lv_point_t * pos,
                         const lv_font_t * font, uint32_t letter, lv_draw_glyph_cb_t cb);
+static uint32_t get_next_line(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                              int32_t max_width);
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                              uint32_t line_end);
 
 /**********************
  *  STATIC VARIABLES
@@ -206,14 +211,16 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
         pos.y += dsc->hint->y;
     }
 
-    uint32_t line_end = line_start + lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL,
-                                                           dsc->flag);
+    /*Get the line breaks and line widths from the cache if the text was already laid out*/
+    lv_text_layout_t * layout = lv_text_layout_acquire(dsc->text, font, dsc->letter_space, w, dsc->flag);
+
+    uint32_t line_end = line_start + get_next_line(dsc, layout, line_start, w);
 
     /*Go the first visible line*/
     while(pos.y + line_height_font < draw_unit->clip_area->y1) {
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_end += get_next_line(dsc, layout, line_start, w);
         pos.y += line_height;
 
         /*Save at the threshold coordinate*/
@@ -223,19 +230,22 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
             dsc->hint->coord_y    = coords->y1;
         }
 
-        if(dsc->text[line_start] == '\0') return;
+        if(dsc->text[line_start] == '\0') {
+            if(layout) lv_text_layout_release(layout);
+            return;
+        }
     }
 
     /*Align to middle*/
     if(align == LV_TEXT_ALIGN_CENTER) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_start, line_end);
 
         pos.x += (lv_area_get_width(coords) - line_width) / 2;
 
     }
     /*Align to the right*/
     else if(align == LV_TEXT_ALIGN_RIGHT) {
-        line_width = lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+        line_width = get_line_width(dsc, layout, line_start, line_end);
         pos.x += lv_area_get_width(coords) - line_width;
     }
 
@@ -346,20 +356,18 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
 #endif
         /*Go to next line*/
         line_start = line_end;
-        line_end += lv_text_get_next_line(&dsc->text[line_start], font, dsc->letter_space, w, NULL, dsc->flag);
+        line_end += get_next_line(dsc, layout, line_start, w);
 
         pos.x = coords->x1;
         /*Align to middle*/
         if(align == LV_TEXT_ALIGN_CENTER) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_start, line_end);
 
             pos.x += (lv_area_get_width(coords) - line_width) / 2;
         }
         /*Align to the right*/
         else if(align == LV_TEXT_ALIGN_RIGHT) {
-            line_width =
-                lv_text_get_width(&dsc->text[line_start], line_end - line_start, font, dsc->letter_space);
+            line_width = get_line_width(dsc, layout, line_start, line_end);
             pos.x += lv_area_get_width(coords) - line_width;
         }
 
@@ -370,6 +378,7 @@ void lv_draw_label_iterate_characters(lv_draw_unit_t * draw_unit, const lv_draw_
     }
 
     if(draw_letter_dsc._draw_buf) lv_draw_buf_destroy(draw_letter_dsc._draw_buf);
+    if(layout) lv_text_layout_release(layout);
 
     LV_ASSERT_MEM_INTEGRITY();
 }
@@ -412,7 +421,14 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
         return;
     }
 
-    if(g.resolved_font) {
+    /*Use the already rendered bitmap of the glyph if it's cached*/
+    const lv_draw_buf_t * cached_buf = lv_font_glyph_cache_acquire(&g);
+
+    if(cached_buf) {
+        dsc->glyph_data = (void *) cached_buf;
+        dsc->format = g.format;
+    }
+    else if(g.resolved_font) {
         lv_draw_buf_t * draw_buf = NULL;
         if(LV_FONT_GLYPH_FORMAT_NONE < g.format && g.format < LV_FONT_GLYPH_FORMAT_IMAGE) {
             /*Only check draw buf for bitmap glyph*/
@@ -440,7 +456,30 @@ static void draw_letter(lv_draw_unit_t * draw_unit, lv_draw_glyph_dsc_t * dsc,
     dsc->g = &g;
     cb(draw_unit, dsc, NULL, NULL);
 
-    lv_font_glyph_release_draw_data(&g);
+    if(cached_buf) lv_font_glyph_cache_release(&g);
+    else lv_font_glyph_release_draw_data(&g);
 
     LV_PROFILER_END;
 }
+
+static uint32_t get_next_line(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                              int32_t max_width)
+{
+    if(layout) {
+        const lv_text_layout_line_t * line = lv_text_layout_get_line(layout, line_start);
+        if(line) return line->end - line_start;
+    }
+
+    return lv_text_get_next_line(&dsc->text[line_start], dsc->font, dsc->letter_space, max_width, NULL, dsc->flag);
+}
+
+static int32_t get_line_width(const lv_draw_label_dsc_t * dsc, const lv_text_layout_t * layout, uint32_t line_start,
+                              uint32_t line_end)
+{
+    if(layout) {
+        const lv_text_layout_line_t * line = lv_text_layout_get_line(layout, line_start);
+        if(line && line->end == line_end) return line->width;
+    }
+
+    return lv_text_get_width(&dsc->text[line_start], line_end - line_start, dsc->font, dsc->letter_space);
+}
@@ -75,6 +75,18 @@ struct lv_draw_task_t {
      */
     uint8_t preference_score;
 
+#if LV_DRAW_TASK_DEP_CELL_SIZE
+    /** Number of older draw tasks overlapping this one which are not removed yet*/
+    uint32_t dep_cnt;
+
+    /** Newer draw tasks overlapping this one. Their `dep_cnt` is decremented when this task is removed.*/
+    lv_draw_task_t ** dependents;
+    uint32_t dependent_cnt;
+    uint32_t dependent_size;
+
+    /** The cells of the layer's `dep_grid` touched by this task*/
+    lv_area_t dep_cells;
+#endif
 };
 
 struct lv_draw_mask_t {
@@ -177,8 +189,10 @@ typedef struct {
 #else
     int dispatch_req;
 #endif
-    lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_DRAW_CULL_TASK_CNT
+    lv_draw_cull_stat_t cull_stat;
+#endif
 } lv_draw_global_info_t;
 
 /**********************
@@ -0,0 +1,352 @@
+/**
+ * @file lv_image_prefetch.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_image_prefetch_private.h"
+#if LV_USE_IMAGE_PREFETCH
+
+#include "lv_image_decoder_private.h"
+#include "../core/lv_global.h"
+#include "../core/lv_obj_private.h"
+#include "../display/lv_display.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "../misc/lv_timer_private.h"
+#include "../widgets/image/lv_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define prefetch (&LV_GLOBAL_DEFAULT()->image_prefetch)
+#define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const void * src;           /**< The source, or a copy of it if it's a file path*/
+    lv_image_src_t src_type;
+    uint32_t queued_time;
+    bool busy;                  /**< It's being decoded now*/
+} lv_image_prefetch_item_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void prefetch_init(void);
+static void lock(void);
+static void unlock(void);
+static bool needs_decoding(const void * src, lv_image_src_t src_type);
+static bool is_cached(const void * src, lv_image_src_t src_type);
+static lv_image_prefetch_item_t * find_item(const void * src, lv_image_src_t src_type);
+static lv_image_prefetch_item_t * take_next_item(void);
+static void decode_item(lv_image_prefetch_item_t * item);
+static lv_obj_tree_walk_res_t obj_tree_walk_cb_add(lv_obj_t * obj, void * user_data);
+static void timer_cb(lv_timer_t * t);
+#if LV_USE_OS
+    static void prefetch_thread_cb(void * ptr);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_image_prefetch_add(const void * src)
+{
+    if(src == NULL || !lv_image_cache_is_enabled()) return;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(!needs_decoding(src, src_type) || is_cached(src, src_type)) return;
+
+    if(!prefetch->inited) prefetch_init();
+
+    lock();
+    bool added = false;
+    if(find_item(src, src_type) == NULL) {
+        lv_image_prefetch_item_t * item = lv_ll_ins_tail(&prefetch->queue);
+        if(item) {
+            item->src = src_type == LV_IMAGE_SRC_FILE ? lv_strdup(src) : src;
+            item->src_type = src_type;
+            item->queued_time = lv_tick_get();
+            item->busy = false;
+            if(item->src == NULL) {
+                lv_ll_remove(&prefetch->queue, item);
+                lv_free(item);
+            }
+            else {
+                prefetch->stat.pending_cnt++;
+                added = true;
+            }
+        }
+    }
+    unlock();
+
+    if(!added) return;
+
+    lv_timer_resume(prefetch->timer);
+#if LV_USE_OS
+    lv_thread_sync_signal(&prefetch->sync);
+#endif
+}
+
+void lv_image_prefetch_obj_tree(lv_obj_t * obj)
+{
+    if(!lv_image_cache_is_enabled()) return;
+
+    lv_obj_tree_walk(obj, obj_tree_walk_cb_add, NULL);
+}
+
+bool lv_image_prefetch_is_pending(const void * src)
+{
+    if(src == NULL || !prefetch->inited) return false;
+
+    lock();
+    bool pending = prefetch->stat.pending_cnt > 0 && find_item(src, lv_image_src_get_type(src)) != NULL;
+    unlock();
+
+    return pending;
+}
+
+void lv_image_prefetch_get_stat(lv_image_prefetch_stat_t * stat)
+{
+    if(!prefetch->inited) {
+        lv_memzero(stat, sizeof(lv_image_prefetch_stat_t));
+        return;
+    }
+
+    lock();
+    *stat = prefetch->stat;
+    unlock();
+}
+
+void lv_image_prefetch_deinit(void)
+{
+    if(!prefetch->inited) return;
+
+#if LV_USE_OS
+    lock();
+    prefetch->exit_status = true;
+    unlock();
+    lv_thread_sync_signal(&prefetch->sync);
+    lv_thread_delete(&prefetch->thread);
+    lv_thread_sync_delete(&prefetch->sync);
+#endif
+
+    lv_image_prefetch_item_t * item;
+    LV_LL_READ(&prefetch->queue, item) {
+        if(item->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)item->src);
+    }
+    lv_ll_clear(&prefetch->queue);
+
+    lv_timer_delete(prefetch->timer);
+
+#if LV_USE_OS
+    lv_mutex_delete(&prefetch->lock);
+#endif
+
+    lv_memzero(prefetch, sizeof(lv_image_prefetch_t));
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void prefetch_init(void)
+{
+    lv_ll_init(&prefetch->queue, sizeof(lv_image_prefetch_item_t));
+    prefetch->timer = lv_timer_create(timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    lv_timer_pause(prefetch->timer);
+
+#if LV_USE_OS
+    lv_mutex_init(&prefetch->lock);
+    lv_thread_sync_init(&prefetch->sync);
+    lv_thread_init(&prefetch->thread, LV_THREAD_PRIO_LOW, prefetch_thread_cb, LV_DRAW_THREAD_STACK_SIZE, NULL);
+#endif
+
+    prefetch->inited = true;
+}
+
+static void lock(void)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&prefetch->lock);
+#endif
+}
+
+static void unlock(void)
+{
+#if LV_USE_OS
+    lv_mutex_unlock(&prefetch->lock);
+#endif
+}
+
+/**
+ * Check if an image source would be decoded into the image cache.
+ * The C arrays are used directly or converted quickly unless they are compressed or need an external decoder.
+ * @param src       an image source
+ * @param src_type  type of the source
+ * @return          true: it's worth to decode the source in advance
+ */
+static bool needs_decoding(const void * src, lv_image_src_t src_type)
+{
+    if(src_type == LV_IMAGE_SRC_FILE) return true;
+    if(src_type != LV_IMAGE_SRC_VARIABLE) return false;
+
+    const lv_image_dsc_t * dsc = src;
+    lv_color_format_t cf = dsc->header.cf;
+    return (dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) || cf == LV_COLOR_FORMAT_RAW ||
+           cf == LV_COLOR_FORMAT_RAW_ALPHA;
+}
+
+static bool is_cached(const void * src, lv_image_src_t src_type)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src_type = src_type;
+    search_key.src = src;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(img_cache_p, entry, NULL);
+    return true;
+}
+
+/*Needs to be called with the lock taken*/
+static lv_image_prefetch_item_t * find_item(const void * src, lv_image_src_t src_type)
+{
+    lv_image_prefetch_item_t * item;
+    LV_LL_READ(&prefetch->queue, item) {
+        if(item->src_type != src_type) continue;
+        if(src_type == LV_IMAGE_SRC_FILE ? lv_strcmp(item->src, src) == 0 : item->src == src) return item;
+    }
+
+    return NULL;
+}
+
+/*Needs to be called with the lock taken*/
+static lv_image_prefetch_item_t * take_next_item(void)
+{
+    lv_image_prefetch_item_t * item;
+    LV_LL_READ(&prefetch->queue, item) {
+        if(!item->busy) {
+            item->busy = true;
+            return item;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Open and close the source so that the decoded image stays in the image cache.
+ * Called without the lock as the decoding can take long.
+ * @param item      an item marked as busy
+ */
+static void decode_item(lv_image_prefetch_item_t * item)
+{
+    uint32_t t = lv_tick_get();
+    lv_image_decoder_dsc_t dsc;
+    lv_result_t res = lv_image_decoder_open(&dsc, item->src, NULL);
+    if(res == LV_RESULT_OK) lv_image_decoder_close(&dsc);
+    uint32_t decode_time = lv_tick_elaps(t);
+
+    lock();
+    lv_image_prefetch_stat_t * stat = &prefetch->stat;
+    if(res == LV_RESULT_OK) {
+        stat->decoded_cnt++;
+        stat->decode_time_sum += decode_time;
+        stat->decode_time_max = LV_MAX(stat->decode_time_max, decode_time);
+    }
+    else {
+        LV_LOG_WARN("couldn't prefetch image");
+        stat->failed_cnt++;
+    }
+    stat->latency_max = LV_MAX(stat->latency_max, lv_tick_elaps(item->queued_time));
+    stat->pending_cnt--;
+    prefetch->ready = true;
+
+    if(item->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)item->src);
+    lv_ll_remove(&prefetch->queue, item);
+    lv_free(item);
+    unlock();
+}
+
+static lv_obj_tree_walk_res_t obj_tree_walk_cb_add(lv_obj_t * obj, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+#if LV_USE_IMAGE
+    if(lv_obj_check_type(obj, &lv_image_class)) lv_image_prefetch_add(lv_image_get_src(obj));
+#endif
+
+    lv_image_prefetch_add(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN));
+
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+/**
+ * Redraw the screens when some images became ready and pause when there is nothing to wait for.
+ * Without an OS decode an image too.
+ */
+static void timer_cb(lv_timer_t * t)
+{
+#if LV_USE_OS == LV_OS_NONE
+    lv_image_prefetch_item_t * item = take_next_item();
+    if(item) decode_item(item);
+#endif
+
+    lock();
+    bool ready = prefetch->ready;
+    bool empty = prefetch->stat.pending_cnt == 0;
+    prefetch->ready = false;
+    unlock();
+
+    if(ready) {
+        /*The images waiting for their source draw only their background, so redraw them.
+         *Invalidating the screens is simpler than looking for the images and happens once per period.*/
+        lv_display_t * disp = lv_display_get_next(NULL);
+        while(disp) {
+            lv_obj_invalidate(lv_display_get_screen_active(disp));
+            lv_obj_t * prev_scr = lv_display_get_screen_prev(disp);
+            if(prev_scr) lv_obj_invalidate(prev_scr);
+            disp = lv_display_get_next(disp);
+        }
+    }
+
+    if(empty) lv_timer_pause(t);
+}
+
+#if LV_USE_OS
+static void prefetch_thread_cb(void * ptr)
+{
+    LV_UNUSED(ptr);
+
+    while(1) {
+        lock();
+        bool exit_status = prefetch->exit_status;
+        lv_image_prefetch_item_t * item = exit_status ? NULL : take_next_item();
+        unlock();
+
+        if(exit_status) break;
+
+        if(item) decode_item(item);
+        else lv_thread_sync_wait(&prefetch->sync);
+    }
+
+    LV_LOG_INFO("exit image prefetch thread");
+}
+#endif
+
+#endif /*LV_USE_IMAGE_PREFETCH*/
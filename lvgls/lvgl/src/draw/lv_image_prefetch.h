@@ -0,0 +1,81 @@
+/**
+ * @file lv_image_prefetch.h
+ *
+ */
+
+#ifndef LV_IMAGE_PREFETCH_H
+#define LV_IMAGE_PREFETCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+
+#if LV_USE_IMAGE_PREFETCH
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    uint32_t decoded_cnt;       /**< Number of images decoded into the image cache*/
+    uint32_t failed_cnt;        /**< Number of images which couldn't be opened*/
+    uint32_t pending_cnt;       /**< Number of images waiting or being decoded now*/
+    uint32_t decode_time_sum;   /**< Sum of the decoding times in milliseconds*/
+    uint32_t decode_time_max;   /**< The longest decoding time in milliseconds*/
+    uint32_t latency_max;       /**< The longest time from queueing to ready in milliseconds*/
+} lv_image_prefetch_stat_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Queue an image source to be decoded into the image cache in the background.
+ * Until it's decoded the image widgets showing this source draw only their background.
+ * Does nothing if the image cache is disabled or the source is already queued.
+ * @param src       an image source: pointer to an `lv_image_dsc_t` or a file path
+ */
+void lv_image_prefetch_add(const void * src);
+
+/**
+ * Queue the sources of all image widgets and background images of an object and its children.
+ * Called by `lv_screen_load_anim()` on the new screen.
+ * @param obj       pointer to an object, typically a screen
+ */
+void lv_image_prefetch_obj_tree(lv_obj_t * obj);
+
+/**
+ * Check if an image source is still waiting to be decoded
+ * @param src       an image source
+ * @return          true: the source is queued or being decoded now
+ */
+bool lv_image_prefetch_is_pending(const void * src);
+
+/**
+ * Get the statistics of the background decoding
+ * @param stat      store the statistics here
+ */
+void lv_image_prefetch_get_stat(lv_image_prefetch_stat_t * stat);
+
+#endif /*LV_USE_IMAGE_PREFETCH*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_PREFETCH_H*/
@@ -0,0 +1,65 @@
+/**
+ * @file lv_image_prefetch_private.h
+ *
+ */
+
+#ifndef LV_IMAGE_PREFETCH_PRIVATE_H
+#define LV_IMAGE_PREFETCH_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_image_prefetch.h"
+
+#if LV_USE_IMAGE_PREFETCH
+
+#include "../misc/lv_ll.h"
+#include "../osal/lv_os.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_ll_t queue;                  /**< The `lv_image_prefetch_item_t`s in the order of queueing*/
+    lv_timer_t * timer;             /**< Decodes (without OS) and invalidates the screens in the main thread*/
+    lv_image_prefetch_stat_t stat;
+    bool ready;                     /**< An image was decoded since the last invalidation*/
+    bool inited;
+#if LV_USE_OS
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;                /**< Protects `queue`, `stat` and `ready`*/
+    bool exit_status;
+#endif
+} lv_image_prefetch_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Called internally to stop the background decoding and free the queue
+ */
+void lv_image_prefetch_deinit(void);
+
+#endif /*LV_USE_IMAGE_PREFETCH*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_PREFETCH_PRIVATE_H*/
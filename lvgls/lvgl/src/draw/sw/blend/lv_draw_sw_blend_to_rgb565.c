@@ -22,6 +22,10 @@
     #include "neon/lv_blend_neon.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_HELIUM
     #include "helium/lv_blend_helium.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+    #include "sse2/lv_blend_sse2.h"
+#elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_VECTOR
+    #include "vector/lv_blend_vector.h"
 #elif LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
     #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
 #endif
@@ -0,0 +1,986 @@
+/**
+ * @file lv_blend_sse2.h
+ *
+ */
+
+#ifndef LV_BLEND_SSE2_H
+#define LV_BLEND_SSE2_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+
+#if !defined(__SSE2__) && !defined(_M_X64) && !(defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#error "LV_DRAW_SW_ASM_SSE2 requires an x86 target with SSE2 enabled"
+#endif
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2 && !defined(__AVX2__)
+#error "LV_DRAW_SW_ASM_AVX2 requires AVX2 to be enabled in the compiler (e.g. -mavx2)"
+#endif
+
+#include <emmintrin.h>
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+#include <immintrin.h>
+#endif
+
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*The kernels are specialized by the constant arguments of the hooks only if they are inlined*/
+#if defined(__GNUC__) || defined(__clang__)
+#define LV_BLEND_SSE2_INLINE static inline __attribute__((always_inline))
+#elif defined(_MSC_VER)
+#define LV_BLEND_SSE2_INLINE static __forceinline
+#else
+#define LV_BLEND_SSE2_INLINE static inline
+#endif
+
+/* The kernels below reproduce the results of the C implementations bit by bit.
+ * Only the NORMAL blend mode is accelerated and only 2 and 4 bytes per pixel formats:
+ * the hooks involving RGB888 (3 bytes) buffers return LV_RESULT_INVALID to use the C fallback.
+ * The plain copies (e.g. RGB565 to RGB565) are not hooked as they are `lv_memcpy()` already.*/
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565(dsc) \
+    lv_color_blend_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    lv_color_blend_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    lv_color_blend_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_rgb565_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_OPA(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_WITH_MASK(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size) \
+    lv_color_blend_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888(dsc, dst_px_size)  \
+    lv_rgb565_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size)  \
+    lv_rgb565_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size)  \
+    lv_rgb565_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size)  \
+    lv_rgb565_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, src_px_size, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, src_px_size, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, src_px_size, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888(dsc, dst_px_size)  \
+    lv_argb8888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_ALPHA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_OPA(dsc, dst_px_size)  \
+    lv_argb8888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_ALPHA_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_WITH_MASK(dsc, dst_px_size)  \
+    lv_argb8888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_ALPHA_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB888_MIX_MASK_OPA(dsc, dst_px_size)  \
+    lv_argb8888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, LV_BLEND_SSE2_MIX_ALPHA_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888(dsc) \
+    lv_color_blend_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_OPA(dsc) \
+    lv_color_blend_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_WITH_MASK(dsc) \
+    lv_color_blend_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_ARGB8888_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+/*The opacity is >= LV_OPA_MAX in the normal case and it becomes the alpha of the pixels*/
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    lv_rgb565_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_argb8888_sse2(dsc, src_px_size, LV_BLEND_SSE2_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_WITH_MASK(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_ARGB8888_MIX_MASK_OPA(dsc)  \
+    lv_argb8888_blend_normal_to_argb8888_sse2(dsc, LV_BLEND_SSE2_MIX_ALPHA_MASK_OPA)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * How to calculate the mix (opacity) of the pixels.
+ * The formulas are the same as in the C implementations.
+ */
+typedef enum {
+    LV_BLEND_SSE2_MIX_NONE,             /**< Cover: mix = 255 or no mixing at all*/
+    LV_BLEND_SSE2_MIX_OPA,              /**< mix = opa*/
+    LV_BLEND_SSE2_MIX_MASK,             /**< mix = mask*/
+    LV_BLEND_SSE2_MIX_MASK_OPA,         /**< mix = LV_OPA_MIX2(mask, opa)*/
+    LV_BLEND_SSE2_MIX_ALPHA,            /**< mix = alpha of the source pixel*/
+    LV_BLEND_SSE2_MIX_ALPHA_OPA,        /**< mix = LV_OPA_MIX2(alpha, opa)*/
+    LV_BLEND_SSE2_MIX_ALPHA_MASK,       /**< mix = LV_OPA_MIX2(alpha, mask)*/
+    LV_BLEND_SSE2_MIX_ALPHA_MASK_OPA,   /**< mix = LV_OPA_MIX3(alpha, mask, opa)*/
+} lv_blend_sse2_mix_t;
+
+/**
+ * Source of the 32 bit destination kernels
+ */
+typedef enum {
+    LV_BLEND_SSE2_SRC_COLOR,            /**< A single color*/
+    LV_BLEND_SSE2_SRC_RGB565,           /**< RGB565 pixels*/
+    LV_BLEND_SSE2_SRC_XRGB8888,         /**< XRGB8888 or ARGB8888 pixels*/
+} lv_blend_sse2_src_t;
+
+/**********************
+ *  STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Load 4 opacity values into the lower 4 16 bit lanes
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_load_opa_x4(const lv_opa_t * p)
+{
+    int32_t v = (int32_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+    return _mm_unpacklo_epi8(_mm_cvtsi32_si128(v), _mm_setzero_si128());
+}
+
+/**
+ * Load 8 opacity values into 16 bit lanes
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_load_opa_x8(const lv_opa_t * p)
+{
+    return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *)p), _mm_setzero_si128());
+}
+
+/**
+ * Calculate the mix values in 16 bit lanes.
+ * @param mode      how to calculate the mix
+ * @param alpha     alpha of the source pixels (used only by the `LV_BLEND_SSE2_MIX_ALPHA...` modes)
+ * @param mask      mask values (used only by the `..._MASK...` modes)
+ * @param opa       the opacity in all lanes
+ * @return          the mix values (0..255)
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_get_mix(lv_blend_sse2_mix_t mode, __m128i alpha, __m128i mask, __m128i opa)
+{
+    switch(mode) {
+        case LV_BLEND_SSE2_MIX_OPA:
+            return opa;
+        case LV_BLEND_SSE2_MIX_MASK:
+            return mask;
+        case LV_BLEND_SSE2_MIX_MASK_OPA:
+            return _mm_srli_epi16(_mm_mullo_epi16(mask, opa), 8);
+        case LV_BLEND_SSE2_MIX_ALPHA:
+            return alpha;
+        case LV_BLEND_SSE2_MIX_ALPHA_OPA:
+            return _mm_srli_epi16(_mm_mullo_epi16(alpha, opa), 8);
+        case LV_BLEND_SSE2_MIX_ALPHA_MASK:
+            return _mm_srli_epi16(_mm_mullo_epi16(alpha, mask), 8);
+        case LV_BLEND_SSE2_MIX_ALPHA_MASK_OPA:
+            /*(alpha * mask) fits into 16 bit and the high half of the product with opa is `>> 16`*/
+            return _mm_mulhi_epu16(_mm_mullo_epi16(alpha, mask), opa);
+        case LV_BLEND_SSE2_MIX_NONE:
+        default:
+            return _mm_set1_epi16(255);
+    }
+}
+
+LV_BLEND_SSE2_INLINE bool lv_blend_sse2_mix_has_mask(lv_blend_sse2_mix_t mode)
+{
+    return mode == LV_BLEND_SSE2_MIX_MASK || mode == LV_BLEND_SSE2_MIX_MASK_OPA ||
+           mode == LV_BLEND_SSE2_MIX_ALPHA_MASK || mode == LV_BLEND_SSE2_MIX_ALPHA_MASK_OPA;
+}
+
+/**
+ * Mix 8 RGB565 pixels like `lv_color_16_16_mix()`.
+ * It's equal to `bg + (((fg - bg) * ((mix + 4) >> 3)) >> 5)` on each channel with arithmetic shift.
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_mix_16_16_x8(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i mask_5 = _mm_set1_epi16(0x1F);
+    const __m128i mask_6 = _mm_set1_epi16(0x3F);
+    __m128i m = _mm_srli_epi16(_mm_add_epi16(mix, _mm_set1_epi16(4)), 3);
+
+    __m128i bg_r = _mm_srli_epi16(bg, 11);
+    __m128i bg_g = _mm_and_si128(_mm_srli_epi16(bg, 5), mask_6);
+    __m128i bg_b = _mm_and_si128(bg, mask_5);
+
+    __m128i r = _mm_sub_epi16(_mm_srli_epi16(fg, 11), bg_r);
+    __m128i g = _mm_sub_epi16(_mm_and_si128(_mm_srli_epi16(fg, 5), mask_6), bg_g);
+    __m128i b = _mm_sub_epi16(_mm_and_si128(fg, mask_5), bg_b);
+
+    r = _mm_add_epi16(bg_r, _mm_srai_epi16(_mm_mullo_epi16(r, m), 5));
+    g = _mm_add_epi16(bg_g, _mm_srai_epi16(_mm_mullo_epi16(g, m), 5));
+    b = _mm_add_epi16(bg_b, _mm_srai_epi16(_mm_mullo_epi16(b, m), 5));
+
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+}
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+/**
+ * The 16 pixel AVX2 version of `lv_blend_sse2_mix_16_16_x8()`
+ */
+LV_BLEND_SSE2_INLINE __m256i lv_blend_avx2_mix_16_16_x16(__m256i fg, __m256i bg, __m256i mix)
+{
+    const __m256i mask_5 = _mm256_set1_epi16(0x1F);
+    const __m256i mask_6 = _mm256_set1_epi16(0x3F);
+    __m256i m = _mm256_srli_epi16(_mm256_add_epi16(mix, _mm256_set1_epi16(4)), 3);
+
+    __m256i bg_r = _mm256_srli_epi16(bg, 11);
+    __m256i bg_g = _mm256_and_si256(_mm256_srli_epi16(bg, 5), mask_6);
+    __m256i bg_b = _mm256_and_si256(bg, mask_5);
+
+    __m256i r = _mm256_sub_epi16(_mm256_srli_epi16(fg, 11), bg_r);
+    __m256i g = _mm256_sub_epi16(_mm256_and_si256(_mm256_srli_epi16(fg, 5), mask_6), bg_g);
+    __m256i b = _mm256_sub_epi16(_mm256_and_si256(fg, mask_5), bg_b);
+
+    r = _mm256_add_epi16(bg_r, _mm256_srai_epi16(_mm256_mullo_epi16(r, m), 5));
+    g = _mm256_add_epi16(bg_g, _mm256_srai_epi16(_mm256_mullo_epi16(g, m), 5));
+    b = _mm256_add_epi16(bg_b, _mm256_srai_epi16(_mm256_mullo_epi16(b, m), 5));
+
+    return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(r, 11), _mm256_slli_epi16(g, 5)), b);
+}
+#endif
+
+/**
+ * Mix 8 XRGB8888 pixels to 8 RGB565 pixels like `lv_color_24_16_mix()`.
+ * The channels of the source pixels are in separate 16 bit vectors.
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_mix_24_16_x8(__m128i red, __m128i green, __m128i blue, __m128i bg,
+                                                 __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i mix_inv = _mm_sub_epi16(_mm_set1_epi16(255), mix);
+
+    __m128i fg_r = _mm_srli_epi16(red, 3);
+    __m128i fg_g = _mm_srli_epi16(green, 2);
+    __m128i fg_b = _mm_srli_epi16(blue, 3);
+
+    __m128i bg_r = _mm_srli_epi16(bg, 11);
+    __m128i bg_g = _mm_and_si128(_mm_srli_epi16(bg, 5), _mm_set1_epi16(0x3F));
+    __m128i bg_b = _mm_and_si128(bg, _mm_set1_epi16(0x1F));
+
+    /*At most 63 * 255 so no overflow*/
+    __m128i r = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(fg_r, mix), _mm_mullo_epi16(bg_r, mix_inv)), 8);
+    __m128i g = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(fg_g, mix), _mm_mullo_epi16(bg_g, mix_inv)), 8);
+    __m128i b = _mm_srli_epi16(_mm_add_epi16(_mm_mullo_epi16(fg_b, mix), _mm_mullo_epi16(bg_b, mix_inv)), 8);
+    __m128i res = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(r, 11), _mm_slli_epi16(g, 5)), b);
+
+    /*mix == 255 is a plain conversion and mix == 0 keeps the background*/
+    __m128i fg = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(fg_r, 11), _mm_slli_epi16(fg_g, 5)), fg_b);
+    __m128i sel_fg = _mm_cmpeq_epi16(mix, _mm_set1_epi16(255));
+    __m128i sel_bg = _mm_cmpeq_epi16(mix, zero);
+    res = _mm_or_si128(_mm_and_si128(sel_fg, fg), _mm_andnot_si128(sel_fg, res));
+    res = _mm_or_si128(_mm_and_si128(sel_bg, bg), _mm_andnot_si128(sel_bg, res));
+    return res;
+}
+
+/**
+ * Mix all 4 bytes of 4 pixels: `(src * mix + dest * (255 - mix)) >> 8`
+ * @param src       4 source pixels
+ * @param dest      4 destination pixels
+ * @param mix       the mix value of the pixels in the lower 4 16 bit lanes
+ * @return          the mixed pixels
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_mix_bytes_x4(__m128i src, __m128i dest, __m128i mix)
+{
+    const __m128i mask_rb = _mm_set1_epi32(0x00FF00FF);
+
+    /*Mix 2 channels in the 2 halves of each pixel at once: red + blue and alpha + green*/
+    __m128i mix_px = _mm_unpacklo_epi16(mix, mix);
+    __m128i mix_inv = _mm_sub_epi16(_mm_set1_epi16(255), mix_px);
+
+    __m128i rb = _mm_add_epi16(_mm_mullo_epi16(_mm_and_si128(src, mask_rb), mix_px),
+                               _mm_mullo_epi16(_mm_and_si128(dest, mask_rb), mix_inv));
+    __m128i ag = _mm_add_epi16(_mm_mullo_epi16(_mm_srli_epi16(src, 8), mix_px),
+                               _mm_mullo_epi16(_mm_srli_epi16(dest, 8), mix_inv));
+
+    return _mm_or_si128(_mm_and_si128(_mm_srli_epi16(rb, 8), mask_rb), _mm_andnot_si128(mask_rb, ag));
+}
+
+/**
+ * Mix 4 pixels to (X)RGB8888 pixels like `lv_color_24_24_mix()`.
+ * The 4th byte of the destination is not modified.
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_mix_24_24_x4(__m128i src, __m128i dest, __m128i mix)
+{
+    const __m128i alpha_mask = _mm_set1_epi32((int32_t)0xFF000000);
+    __m128i res = lv_blend_sse2_mix_bytes_x4(src, dest, mix);
+
+    __m128i mix32 = _mm_unpacklo_epi16(mix, _mm_setzero_si128());
+    __m128i sel_src = _mm_cmpgt_epi32(mix32, _mm_set1_epi32(LV_OPA_MAX - 1));
+    __m128i sel_dest = _mm_cmpeq_epi32(mix32, _mm_setzero_si128());
+    res = _mm_or_si128(_mm_and_si128(sel_src, src), _mm_andnot_si128(sel_src, res));
+    res = _mm_or_si128(_mm_and_si128(sel_dest, dest), _mm_andnot_si128(sel_dest, res));
+
+    return _mm_or_si128(_mm_and_si128(alpha_mask, dest), _mm_andnot_si128(alpha_mask, res));
+}
+
+/**
+ * The same as `lv_color_32_32_mix()` of the C implementation without the cache.
+ */
+LV_BLEND_SSE2_INLINE lv_color32_t lv_blend_sse2_color_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        lv_opa_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+/**
+ * Mix 4 ARGB8888 pixels like `lv_color_32_32_mix()`.
+ * If all the background pixels are opaque it's a simple mix,
+ * else the pixels are mixed one by one.
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_mix_32_32_x4(__m128i fg, __m128i bg)
+{
+    const __m128i alpha_mask = _mm_set1_epi32((int32_t)0xFF000000);
+
+    if(_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(bg, alpha_mask), alpha_mask)) != 0xFFFF) {
+        lv_color32_t fg_px[4];
+        lv_color32_t bg_px[4];
+        _mm_storeu_si128((__m128i *)fg_px, fg);
+        _mm_storeu_si128((__m128i *)bg_px, bg);
+        uint32_t i;
+        for(i = 0; i < 4; i++) {
+            bg_px[i] = lv_blend_sse2_color_32_32_mix(fg_px[i], bg_px[i]);
+        }
+        return _mm_loadu_si128((const __m128i *)bg_px);
+    }
+
+    __m128i fg_a = _mm_srli_epi32(fg, 24);
+    __m128i res = lv_blend_sse2_mix_bytes_x4(fg, bg, _mm_packs_epi32(fg_a, fg_a));
+    res = _mm_or_si128(res, alpha_mask);
+
+    __m128i sel_fg = _mm_cmpgt_epi32(fg_a, _mm_set1_epi32(LV_OPA_MAX - 1));
+    __m128i sel_bg = _mm_cmplt_epi32(fg_a, _mm_set1_epi32(LV_OPA_MIN + 1));
+    res = _mm_or_si128(_mm_and_si128(sel_fg, fg), _mm_andnot_si128(sel_fg, res));
+    res = _mm_or_si128(_mm_and_si128(sel_bg, bg), _mm_andnot_si128(sel_bg, res));
+    return res;
+}
+
+/**
+ * Convert 4 RGB565 pixels to XRGB8888 the same way as the C implementation (X = 0)
+ */
+LV_BLEND_SSE2_INLINE __m128i lv_blend_sse2_rgb565_to_xrgb8888_x4(const uint16_t * src)
+{
+    __m128i c = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+    /*The upper 16 bits are 0 so 16 bit multiplications are enough*/
+    __m128i r = _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(c, 11), _mm_set1_epi32(2106)), 8);
+    __m128i g = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(_mm_srli_epi32(c, 5), _mm_set1_epi32(0x3F)),
+                                               _mm_set1_epi32(1037)), 8);
+    __m128i b = _mm_srli_epi32(_mm_mullo_epi16(_mm_and_si128(c, _mm_set1_epi32(0x1F)), _mm_set1_epi32(2106)), 8);
+
+    return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r, 16), _mm_slli_epi32(g, 8)), b);
+}
+
+/**
+ * Blend 8 pixels to RGB565 from an RGB565 buffer or a color
+ */
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_rgb565_step_x8(uint16_t * dest, const uint16_t * src, __m128i color,
+                                                const lv_opa_t * mask, __m128i opa, lv_blend_sse2_mix_t mode)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    __m128i fg = src ? _mm_loadu_si128((const __m128i *)src) : color;
+    __m128i mask_v = lv_blend_sse2_mix_has_mask(mode) ? lv_blend_sse2_load_opa_x8(mask) : zero;
+    __m128i mix = lv_blend_sse2_get_mix(mode, zero, mask_v, opa);
+    _mm_storeu_si128((__m128i *)dest, lv_blend_sse2_mix_16_16_x8(fg, bg, mix));
+}
+
+/**
+ * Blend a line to RGB565 from an RGB565 buffer (`src != NULL`) or a color
+ */
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_rgb565_line(uint16_t * dest, const uint16_t * src, uint16_t color16,
+                                             const lv_opa_t * mask, lv_opa_t opa, lv_blend_sse2_mix_t mode, int32_t w)
+{
+    __m128i color = _mm_set1_epi16((int16_t)color16);
+    __m128i opa_v = _mm_set1_epi16(opa);
+    int32_t x = 0;
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+    {
+        __m256i color_256 = _mm256_set1_epi16((int16_t)color16);
+        __m256i opa_256 = _mm256_set1_epi16(opa);
+        for(; x <= w - 16; x += 16) {
+            __m256i bg = _mm256_loadu_si256((const __m256i *)&dest[x]);
+            __m256i fg = src ? _mm256_loadu_si256((const __m256i *)&src[x]) : color_256;
+            __m256i mask_v = _mm256_setzero_si256();
+            if(lv_blend_sse2_mix_has_mask(mode)) {
+                mask_v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)&mask[x]));
+            }
+            __m256i mix;
+            if(mode == LV_BLEND_SSE2_MIX_OPA) mix = opa_256;
+            else if(mode == LV_BLEND_SSE2_MIX_MASK) mix = mask_v;
+            else mix = _mm256_srli_epi16(_mm256_mullo_epi16(mask_v, opa_256), 8);
+            _mm256_storeu_si256((__m256i *)&dest[x], lv_blend_avx2_mix_16_16_x16(fg, bg, mix));
+        }
+    }
+#endif
+
+    for(; x <= w - 8; x += 8) {
+        lv_blend_sse2_rgb565_step_x8(&dest[x], src ? &src[x] : NULL, color, mask ? &mask[x] : NULL, opa_v, mode);
+    }
+
+    /*Process the last pixels in a temporary buffer*/
+    if(x < w) {
+        uint16_t dest_tmp[8] = {0};
+        uint16_t src_tmp[8] = {0};
+        lv_opa_t mask_tmp[8] = {0};
+        int32_t n = w - x;
+        int32_t i;
+        for(i = 0; i < n; i++) {
+            dest_tmp[i] = dest[x + i];
+            if(src) src_tmp[i] = src[x + i];
+            if(mask) mask_tmp[i] = mask[x + i];
+        }
+        lv_blend_sse2_rgb565_step_x8(dest_tmp, src ? src_tmp : NULL, color, mask_tmp, opa_v, mode);
+        for(i = 0; i < n; i++) {
+            dest[x + i] = dest_tmp[i];
+        }
+    }
+}
+
+/**
+ * Blend 8 XRGB8888 or ARGB8888 pixels to RGB565
+ */
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_rgb565_from_xrgb8888_step_x8(uint16_t * dest, const uint32_t * src,
+                                                                      const lv_opa_t * mask, __m128i opa,
+                                                                      lv_blend_sse2_mix_t mode)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask_8 = _mm_set1_epi32(0xFF);
+    __m128i s0 = _mm_loadu_si128((const __m128i *)src);
+    __m128i s1 = _mm_loadu_si128((const __m128i *)(src + 4));
+
+    __m128i blue = _mm_packs_epi32(_mm_and_si128(s0, mask_8), _mm_and_si128(s1, mask_8));
+    __m128i green = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 8), mask_8),
+                                    _mm_and_si128(_mm_srli_epi32(s1, 8), mask_8));
+    __m128i red = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(s0, 16), mask_8),
+                                  _mm_and_si128(_mm_srli_epi32(s1, 16), mask_8));
+    __m128i alpha = _mm_packs_epi32(_mm_srli_epi32(s0, 24), _mm_srli_epi32(s1, 24));
+
+    __m128i mask_v = lv_blend_sse2_mix_has_mask(mode) ? lv_blend_sse2_load_opa_x8(mask) : zero;
+    __m128i mix = lv_blend_sse2_get_mix(mode, alpha, mask_v, opa);
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+    _mm_storeu_si128((__m128i *)dest, lv_blend_sse2_mix_24_16_x8(red, green, blue, bg, mix));
+}
+
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_rgb565_from_xrgb8888_line(uint16_t * dest, const uint32_t * src,
+                                                                   const lv_opa_t * mask, lv_opa_t opa,
+                                                                   lv_blend_sse2_mix_t mode, int32_t w)
+{
+    __m128i opa_v = _mm_set1_epi16(opa);
+    int32_t x;
+    for(x = 0; x <= w - 8; x += 8) {
+        lv_blend_sse2_rgb565_from_xrgb8888_step_x8(&dest[x], &src[x], mask ? &mask[x] : NULL, opa_v, mode);
+    }
+
+    if(x < w) {
+        uint16_t dest_tmp[8] = {0};
+        uint32_t src_tmp[8] = {0};
+        lv_opa_t mask_tmp[8] = {0};
+        int32_t n = w - x;
+        int32_t i;
+        for(i = 0; i < n; i++) {
+            dest_tmp[i] = dest[x + i];
+            src_tmp[i] = src[x + i];
+            if(mask) mask_tmp[i] = mask[x + i];
+        }
+        lv_blend_sse2_rgb565_from_xrgb8888_step_x8(dest_tmp, src_tmp, mask_tmp, opa_v, mode);
+        for(i = 0; i < n; i++) {
+            dest[x + i] = dest_tmp[i];
+        }
+    }
+}
+
+/**
+ * Blend 4 pixels to XRGB8888 (like `lv_color_24_24_mix()`) or to ARGB8888 (like `lv_color_32_32_mix()`)
+ */
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_xrgb8888_step_x4(uint32_t * dest, const void * src,
+                                                          lv_blend_sse2_src_t src_type, __m128i color,
+                                                          const lv_opa_t * mask, __m128i opa,
+                                                          lv_blend_sse2_mix_t mode, bool argb)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i fg;
+    if(src_type == LV_BLEND_SSE2_SRC_RGB565) fg = lv_blend_sse2_rgb565_to_xrgb8888_x4(src);
+    else if(src_type == LV_BLEND_SSE2_SRC_XRGB8888) fg = _mm_loadu_si128((const __m128i *)src);
+    else fg = color;
+
+    __m128i alpha = _mm_packs_epi32(_mm_srli_epi32(fg, 24), zero);
+    __m128i mask_v = lv_blend_sse2_mix_has_mask(mode) ? lv_blend_sse2_load_opa_x4(mask) : zero;
+    __m128i mix = lv_blend_sse2_get_mix(mode, alpha, mask_v, opa);
+    __m128i bg = _mm_loadu_si128((const __m128i *)dest);
+
+    if(argb) {
+        /*The mix is the alpha channel of the foreground*/
+        const __m128i alpha_mask = _mm_set1_epi32((int32_t)0xFF000000);
+        fg = _mm_or_si128(_mm_andnot_si128(alpha_mask, fg), _mm_slli_epi32(_mm_unpacklo_epi16(mix, zero), 24));
+        _mm_storeu_si128((__m128i *)dest, lv_blend_sse2_mix_32_32_x4(fg, bg));
+    }
+    else {
+        _mm_storeu_si128((__m128i *)dest, lv_blend_sse2_mix_24_24_x4(fg, bg, mix));
+    }
+}
+
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_xrgb8888_line(uint32_t * dest, const void * src, lv_blend_sse2_src_t src_type,
+                                               __m128i color, const lv_opa_t * mask, lv_opa_t opa,
+                                               lv_blend_sse2_mix_t mode, bool argb, int32_t w)
+{
+    const uint16_t * src16 = src;
+    const uint32_t * src32 = src;
+    __m128i opa_v = _mm_set1_epi16(opa);
+    int32_t x;
+    for(x = 0; x <= w - 4; x += 4) {
+        const void * src_x = src_type == LV_BLEND_SSE2_SRC_RGB565 ? (const void *)&src16[x] : (const void *)&src32[x];
+        lv_blend_sse2_xrgb8888_step_x4(&dest[x], src_type == LV_BLEND_SSE2_SRC_COLOR ? NULL : src_x, src_type,
+                                       color, mask ? &mask[x] : NULL, opa_v, mode, argb);
+    }
+
+    if(x < w) {
+        uint32_t dest_tmp[4] = {0};
+        uint32_t src_tmp[4] = {0};
+        uint16_t * src16_tmp = (uint16_t *)src_tmp;
+        lv_opa_t mask_tmp[4] = {0};
+        int32_t n = w - x;
+        int32_t i;
+        for(i = 0; i < n; i++) {
+            dest_tmp[i] = dest[x + i];
+            if(src_type == LV_BLEND_SSE2_SRC_RGB565) src16_tmp[i] = src16[x + i];
+            else if(src_type == LV_BLEND_SSE2_SRC_XRGB8888) src_tmp[i] = src32[x + i];
+            if(mask) mask_tmp[i] = mask[x + i];
+        }
+        lv_blend_sse2_xrgb8888_step_x4(dest_tmp, src_tmp, src_type, color, mask_tmp, opa_v, mode, argb);
+        for(i = 0; i < n; i++) {
+            dest[x + i] = dest_tmp[i];
+        }
+    }
+}
+
+/**
+ * Fill an area with a color without mixing
+ */
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_fill_u32(uint32_t * dest, int32_t w, int32_t h, int32_t stride,
+                                                  uint32_t color32)
+{
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        int32_t x = 0;
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+        __m256i c_256 = _mm256_set1_epi32((int32_t)color32);
+        for(; x <= w - 8; x += 8) {
+            _mm256_storeu_si256((__m256i *)&dest[x], c_256);
+        }
+#endif
+        __m128i c = _mm_set1_epi32((int32_t)color32);
+        for(; x <= w - 4; x += 4) {
+            _mm_storeu_si128((__m128i *)&dest[x], c);
+        }
+        for(; x < w; x++) {
+            dest[x] = color32;
+        }
+        dest = (uint32_t *)((uint8_t *)dest + stride);
+    }
+}
+
+/**
+ * Blend an image or a color to an XRGB8888 or ARGB8888 buffer
+ */
+LV_BLEND_SSE2_INLINE void lv_blend_sse2_to_xrgb8888(void * dest_buf, int32_t w, int32_t h, int32_t dest_stride,
+                                             const void * src_buf, int32_t src_stride, lv_blend_sse2_src_t src_type,
+                                             lv_color_t color, const lv_opa_t * mask, int32_t mask_stride, lv_opa_t opa,
+                                             lv_blend_sse2_mix_t mode, bool argb)
+{
+    uint8_t * dest = dest_buf;
+    const uint8_t * src = src_buf;
+    __m128i color_v = _mm_set1_epi32((int32_t)lv_color_to_u32(color));
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        lv_blend_sse2_xrgb8888_line((uint32_t *)dest, src, src_type, color_v, mask, opa, mode, argb, w);
+        dest += dest_stride;
+        if(src) src += src_stride;
+        if(mask) mask += mask_stride;
+    }
+}
+
+/*=====================
+ * RGB565 destination
+ *====================*/
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_color_blend_to_rgb565_sse2(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                lv_blend_sse2_mix_t mode)
+{
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint8_t * dest = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t w = dsc->dest_w;
+    int32_t y;
+
+    for(y = 0; y < dsc->dest_h; y++) {
+        uint16_t * dest16 = (uint16_t *)dest;
+        if(mode == LV_BLEND_SSE2_MIX_NONE) {
+            int32_t x = 0;
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2
+            __m256i c_256 = _mm256_set1_epi16((int16_t)color16);
+            for(; x <= w - 16; x += 16) {
+                _mm256_storeu_si256((__m256i *)&dest16[x], c_256);
+            }
+#endif
+            __m128i c = _mm_set1_epi16((int16_t)color16);
+            for(; x <= w - 8; x += 8) {
+                _mm_storeu_si128((__m128i *)&dest16[x], c);
+            }
+            for(; x < w; x++) {
+                dest16[x] = color16;
+            }
+        }
+        else {
+            lv_blend_sse2_rgb565_line(dest16, NULL, color16, mask, dsc->opa, mode, w);
+            if(mask) mask += dsc->mask_stride;
+        }
+        dest += dsc->dest_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_rgb565_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                lv_blend_sse2_mix_t mode)
+{
+    uint8_t * dest = dsc->dest_buf;
+    const uint8_t * src = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t y;
+
+    for(y = 0; y < dsc->dest_h; y++) {
+        lv_blend_sse2_rgb565_line((uint16_t *)dest, (const uint16_t *)src, 0, mask, dsc->opa, mode, dsc->dest_w);
+        dest += dsc->dest_stride;
+        src += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_argb8888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  lv_blend_sse2_mix_t mode)
+{
+    uint8_t * dest = dsc->dest_buf;
+    const uint8_t * src = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t y;
+
+    for(y = 0; y < dsc->dest_h; y++) {
+        lv_blend_sse2_rgb565_from_xrgb8888_line((uint16_t *)dest, (const uint32_t *)src, mask, dsc->opa, mode,
+                                                dsc->dest_w);
+        dest += dsc->dest_stride;
+        src += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_rgb888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                uint32_t src_px_size, lv_blend_sse2_mix_t mode)
+{
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    /*The alpha channel is not used so it's the same as ARGB8888 but with the given mix*/
+    return lv_argb8888_blend_normal_to_rgb565_sse2(dsc, mode);
+}
+
+/*=====================
+ * XRGB8888 destination
+ *====================*/
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_color_blend_to_rgb888_sse2(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size,
+                                                        lv_blend_sse2_mix_t mode)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    if(mode == LV_BLEND_SSE2_MIX_NONE) {
+        lv_blend_sse2_fill_u32(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, lv_color_to_u32(dsc->color));
+    }
+    else {
+        lv_blend_sse2_to_xrgb8888(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, NULL, 0,
+                                  LV_BLEND_SSE2_SRC_COLOR, dsc->color,
+                                  dsc->mask_buf, dsc->mask_stride, dsc->opa, mode, false);
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_rgb565_blend_normal_to_rgb888_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                uint32_t dst_px_size, lv_blend_sse2_mix_t mode)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_blend_sse2_to_xrgb8888(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, dsc->src_buf, dsc->src_stride,
+                              LV_BLEND_SSE2_SRC_RGB565, lv_color_black(),
+                              dsc->mask_buf, dsc->mask_stride, dsc->opa, mode, false);
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_rgb888_blend_normal_to_rgb888_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                        uint32_t dst_px_size, uint32_t src_px_size,
+                                                                        lv_blend_sse2_mix_t mode)
+{
+    if(dst_px_size != 4 || src_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_blend_sse2_to_xrgb8888(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, dsc->src_buf, dsc->src_stride,
+                              LV_BLEND_SSE2_SRC_XRGB8888, lv_color_black(),
+                              dsc->mask_buf, dsc->mask_stride, dsc->opa, mode, false);
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_argb8888_blend_normal_to_rgb888_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t dst_px_size, lv_blend_sse2_mix_t mode)
+{
+    return lv_rgb888_blend_normal_to_rgb888_sse2(dsc, dst_px_size, 4, mode);
+}
+
+/*=====================
+ * ARGB8888 destination
+ *====================*/
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_color_blend_to_argb8888_sse2(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                  lv_blend_sse2_mix_t mode)
+{
+    if(mode == LV_BLEND_SSE2_MIX_NONE) {
+        lv_blend_sse2_fill_u32(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, lv_color_to_u32(dsc->color));
+    }
+    else {
+        lv_blend_sse2_to_xrgb8888(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, NULL, 0,
+                                  LV_BLEND_SSE2_SRC_COLOR, dsc->color,
+                                  dsc->mask_buf, dsc->mask_stride, dsc->opa, mode, true);
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_rgb565_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  lv_blend_sse2_mix_t mode)
+{
+    lv_blend_sse2_to_xrgb8888(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, dsc->src_buf, dsc->src_stride,
+                              LV_BLEND_SSE2_SRC_RGB565, lv_color_black(),
+                              dsc->mask_buf, dsc->mask_stride, dsc->opa, mode, true);
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_rgb888_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                  uint32_t src_px_size, lv_blend_sse2_mix_t mode)
+{
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    lv_blend_sse2_to_xrgb8888(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, dsc->src_buf, dsc->src_stride,
+                              LV_BLEND_SSE2_SRC_XRGB8888, lv_color_black(),
+                              dsc->mask_buf, dsc->mask_stride, dsc->opa, mode, true);
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_SSE2_INLINE lv_result_t lv_argb8888_blend_normal_to_argb8888_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                    lv_blend_sse2_mix_t mode)
+{
+    return lv_rgb888_blend_normal_to_argb8888_sse2(dsc, 4, mode);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2 || LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_AVX2*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_SSE2_H*/
@@ -0,0 +1,307 @@
+/**
+ * @file lv_blend_sse2_bench.c
+ *
+ * Throughput benchmark and conformance check of the SW blend functions.
+ * It's a standalone program which is compiled only if `LV_BLEND_SSE2_BENCH` is defined.
+ *
+ * Build it on an x86 host with `LV_USE_DRAW_SW_ASM` set to `LV_DRAW_SW_ASM_SSE2` in `lv_conf.h`
+ * (or `LV_DRAW_SW_ASM_AVX2` and add `-mavx2`). It works the same way with `LV_DRAW_SW_ASM_VECTOR`
+ * on any GCC 9+ or clang host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_BLEND_SSE2_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o blend_bench
+ *
+ * Usage:
+ * - `./blend_bench check`: blend random areas of random sizes, strides, colors, masks and opacities
+ *   to every destination format and print a hash of each result and of all of them.
+ *   Build it again with `LV_DRAW_SW_ASM_NONE` and compare the outputs:
+ *   the hashes are the same only if the results are bit-exact with the C implementation.
+ * - `./blend_bench perf [small]`: print the throughput of the hooked blend cases in megapixels per second
+ *   on 800x480 areas (or on 128x16 areas with `small`). The best of 7 runs is printed.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_BLEND_SSE2_BENCH
+
+#include "../../../../../lvgl.h"
+#include "../lv_draw_sw_blend_private.h"
+#include "../lv_draw_sw_blend_to_rgb565.h"
+#include "../lv_draw_sw_blend_to_rgb888.h"
+#include "../lv_draw_sw_blend_to_argb8888.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CHECK_ITER_CNT  200000
+#define CHECK_MAX_W     70
+#define CHECK_MAX_H     4
+#define CHECK_BUF_SIZE  (200 * 8 * 4 + 64)
+
+#define PERF_W          800
+#define PERF_H          480
+#define PERF_REP_CNT    7
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const char * name;
+    uint32_t dest_px_size;      /**< 2: RGB565, 4: XRGB8888, 5: ARGB8888*/
+    int32_t src_cf;             /**< -1: fill, else the color format of the source image*/
+    bool mask;
+    lv_opa_t opa;
+} perf_case_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void check(void);
+static void perf(int32_t w, int32_t h);
+static void blend(uint32_t dest_px_size, int32_t src_cf, void * dest, int32_t w, int32_t h, int32_t dest_stride,
+                  const void * src, int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride, lv_color_t color,
+                  lv_opa_t opa);
+static uint32_t get_px_size(int32_t cf);
+static uint32_t rnd(void);
+static uint8_t rnd_byte(void);
+static uint64_t hash(const uint8_t * p, size_t len);
+static double now_sec(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint32_t rnd_state = 12345;
+
+static const perf_case_t perf_cases[] = {
+    {"fill rgb565",             2, -1, false, LV_OPA_COVER},
+    {"fill rgb565 opa",         2, -1, false, LV_OPA_50},
+    {"fill rgb565 mask",        2, -1, true, LV_OPA_COVER},
+    {"fill rgb565 mask opa",    2, -1, true, LV_OPA_50},
+    {"rgb565->rgb565 opa",      2, LV_COLOR_FORMAT_RGB565, false, LV_OPA_50},
+    {"rgb565->rgb565 mask",     2, LV_COLOR_FORMAT_RGB565, true, LV_OPA_COVER},
+    {"xrgb8888->rgb565",        2, LV_COLOR_FORMAT_XRGB8888, false, LV_OPA_COVER},
+    {"argb8888->rgb565",        2, LV_COLOR_FORMAT_ARGB8888, false, LV_OPA_COVER},
+    {"argb8888->rgb565 mask opa", 2, LV_COLOR_FORMAT_ARGB8888, true, LV_OPA_50},
+    {"l8->rgb565",              2, LV_COLOR_FORMAT_L8, false, LV_OPA_COVER},
+    {"al88->rgb565 mask opa",   2, LV_COLOR_FORMAT_AL88, true, LV_OPA_50},
+    {"fill xrgb8888 opa",       4, -1, false, LV_OPA_50},
+    {"fill xrgb8888 mask",      4, -1, true, LV_OPA_COVER},
+    {"rgb565->xrgb8888",        4, LV_COLOR_FORMAT_RGB565, false, LV_OPA_COVER},
+    {"argb8888->xrgb8888",      4, LV_COLOR_FORMAT_ARGB8888, false, LV_OPA_COVER},
+    {"fill argb8888",           5, -1, false, LV_OPA_COVER},
+    {"fill argb8888 opa",       5, -1, false, LV_OPA_50},
+    {"fill argb8888 mask",      5, -1, true, LV_OPA_COVER},
+    {"argb8888->argb8888",      5, LV_COLOR_FORMAT_ARGB8888, false, LV_OPA_COVER},
+    {"argb8888->argb8888 mask", 5, LV_COLOR_FORMAT_ARGB8888, true, LV_OPA_COVER},
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    lv_init();
+
+    if(argc > 1 && strcmp(argv[1], "check") == 0) {
+        check();
+    }
+    else if(argc > 1 && strcmp(argv[1], "perf") == 0) {
+        bool small = argc > 2 && strcmp(argv[2], "small") == 0;
+        perf(small ? 128 : PERF_W, small ? 16 : PERF_H);
+    }
+    else {
+        printf("Usage: %s check | perf [small]\n", argv[0]);
+        return 1;
+    }
+
+    lv_deinit();
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void check(void)
+{
+    static uint8_t dest[CHECK_BUF_SIZE];
+    static uint8_t src[CHECK_BUF_SIZE];
+    static lv_opa_t mask[CHECK_BUF_SIZE / 4];
+    static const int32_t src_cfs[] = {-1, LV_COLOR_FORMAT_RGB565, LV_COLOR_FORMAT_RGB888,
+                                      LV_COLOR_FORMAT_XRGB8888, LV_COLOR_FORMAT_ARGB8888,
+                                      LV_COLOR_FORMAT_L8, LV_COLOR_FORMAT_AL88
+                                     };
+    static const uint32_t dest_px_sizes[] = {2, 3, 4, 5};
+
+    uint64_t hash_all = 0;
+    uint32_t i;
+    for(i = 0; i < CHECK_ITER_CNT; i++) {
+        uint32_t dest_px_size = dest_px_sizes[rnd() % 4];
+        int32_t src_cf = src_cfs[rnd() % (sizeof(src_cfs) / sizeof(src_cfs[0]))];
+        uint32_t dest_px_bytes = dest_px_size == 5 ? 4 : dest_px_size;
+        int32_t w = 1 + rnd() % CHECK_MAX_W;
+        int32_t h = 1 + rnd() % CHECK_MAX_H;
+
+        /*Test the unaligned and padded strides too*/
+        int32_t dest_stride = w * dest_px_bytes + (rnd() % 3) * 4;
+        int32_t src_stride = w * get_px_size(src_cf) + (rnd() % 3) * 4;
+        int32_t mask_stride = w + rnd() % 5;
+
+        uint32_t k;
+        for(k = 0; k < sizeof(dest); k++) dest[k] = rnd_byte();
+        for(k = 0; k < sizeof(src); k++) src[k] = rnd_byte();
+        for(k = 0; k < sizeof(mask); k++) mask[k] = rnd_byte();
+
+        /*ARGB8888 has different code paths for opaque backgrounds*/
+        if(dest_px_size == 5 && rnd() % 2) {
+            for(k = 3; k < sizeof(dest); k += 4) dest[k] = LV_OPA_COVER;
+        }
+
+        bool use_mask = rnd() % 2;
+        lv_opa_t opa = rnd() % 2 ? LV_OPA_COVER : rnd_byte();
+        if(opa <= LV_OPA_MIN) opa = LV_OPA_MIN + 1 + rnd() % 10;
+
+        blend(dest_px_size, src_cf, dest, w, h, dest_stride, src, src_stride, use_mask ? mask : NULL, mask_stride,
+              lv_color_hex(rnd()), opa);
+
+        uint64_t h_dest = hash(dest, sizeof(dest));
+        hash_all = hash_all * 31 + h_dest;
+        printf("%"LV_PRIu32" %"LV_PRIu32" %"LV_PRId32" %"LV_PRId32"x%"LV_PRId32" mask:%d opa:%d %016llx\n",
+               i, dest_px_size, src_cf, w, h, use_mask, opa, (unsigned long long)h_dest);
+    }
+
+    printf("all %016llx\n", (unsigned long long)hash_all);
+}
+
+static void perf(int32_t w, int32_t h)
+{
+    static uint8_t dest[PERF_W * PERF_H * 4];
+    static uint8_t src[PERF_W * PERF_H * 4];
+    static lv_opa_t mask[PERF_W * PERF_H];
+
+    uint32_t k;
+    for(k = 0; k < sizeof(dest); k++) {
+        dest[k] = rnd();
+        src[k] = rnd();
+    }
+    for(k = 0; k < sizeof(mask); k++) mask[k] = rnd();
+
+    /*Blend about the same number of pixels with the small areas*/
+    uint32_t it_cnt = 40 * (PERF_W * PERF_H) / (w * h);
+
+    uint32_t c;
+    for(c = 0; c < sizeof(perf_cases) / sizeof(perf_cases[0]); c++) {
+        const perf_case_t * pc = &perf_cases[c];
+        uint32_t dest_px_bytes = pc->dest_px_size == 5 ? 4 : pc->dest_px_size;
+        double best = 1e9;
+        uint32_t rep;
+        for(rep = 0; rep < PERF_REP_CNT; rep++) {
+            /*Start from an opaque background in every run*/
+            for(k = 3; k < sizeof(dest); k += 4) dest[k] = LV_OPA_COVER;
+
+            double t_start = now_sec();
+            uint32_t it;
+            for(it = 0; it < it_cnt; it++) {
+                blend(pc->dest_px_size, pc->src_cf, dest, w, h, w * dest_px_bytes, src, w * get_px_size(pc->src_cf),
+                      pc->mask ? mask : NULL, w, lv_color_hex(0x3366cc), pc->opa);
+            }
+            double t = now_sec() - t_start;
+            if(t < best) best = t;
+        }
+
+        printf("%-28s %8.1f Mpx/s\n", pc->name, (double)w * h * it_cnt / best / 1e6);
+    }
+}
+
+static void blend(uint32_t dest_px_size, int32_t src_cf, void * dest, int32_t w, int32_t h, int32_t dest_stride,
+                  const void * src, int32_t src_stride, const lv_opa_t * mask, int32_t mask_stride, lv_color_t color,
+                  lv_opa_t opa)
+{
+    if(src_cf < 0) {
+        lv_draw_sw_blend_fill_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        dsc.dest_buf = dest;
+        dsc.dest_w = w;
+        dsc.dest_h = h;
+        dsc.dest_stride = dest_stride;
+        dsc.mask_buf = mask;
+        dsc.mask_stride = mask_stride;
+        dsc.color = color;
+        dsc.opa = opa;
+        if(dest_px_size == 2) lv_draw_sw_blend_color_to_rgb565(&dsc);
+        else if(dest_px_size == 5) lv_draw_sw_blend_color_to_argb8888(&dsc);
+        else lv_draw_sw_blend_color_to_rgb888(&dsc, dest_px_size);
+    }
+    else {
+        lv_draw_sw_blend_image_dsc_t dsc;
+        lv_memzero(&dsc, sizeof(dsc));
+        dsc.dest_buf = dest;
+        dsc.dest_w = w;
+        dsc.dest_h = h;
+        dsc.dest_stride = dest_stride;
+        dsc.mask_buf = mask;
+        dsc.mask_stride = mask_stride;
+        dsc.opa = opa;
+        dsc.src_buf = src;
+        dsc.src_stride = src_stride;
+        dsc.src_color_format = src_cf;
+        dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+        if(dest_px_size == 2) lv_draw_sw_blend_image_to_rgb565(&dsc);
+        else if(dest_px_size == 5) lv_draw_sw_blend_image_to_argb8888(&dsc);
+        else lv_draw_sw_blend_image_to_rgb888(&dsc, dest_px_size);
+    }
+}
+
+static uint32_t get_px_size(int32_t cf)
+{
+    if(cf < 0) return 0;
+    return lv_color_format_get_size(cf);
+}
+
+static uint32_t rnd(void)
+{
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+/**
+ * Get a random byte. The values around 0 and 255 are more likely as the blend functions handle them specially.
+ */
+static uint8_t rnd_byte(void)
+{
+    static const uint8_t special[] = {0, 1, 2, 3, 4, 5, 128, 251, 252, 253, 254, 255};
+    if(rnd() % 10 < 3) return special[rnd() % sizeof(special)];
+    return rnd() & 0xff;
+}
+
+static uint64_t hash(const uint8_t * p, size_t len)
+{
+    uint64_t h = 1469598103934665603ULL;
+    size_t i;
+    for(i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+static double now_sec(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+#endif /*LV_BLEND_SSE2_BENCH*/
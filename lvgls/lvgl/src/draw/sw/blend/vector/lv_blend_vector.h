@@ -0,0 +1,496 @@
+/**
+ * @file lv_blend_vector.h
+ *
+ */
+
+#ifndef LV_BLEND_VECTOR_H
+#define LV_BLEND_VECTOR_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../../../lv_conf_internal.h"
+
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_VECTOR
+
+#if !defined(__clang__) && !(defined(__GNUC__) && __GNUC__ >= 9)
+#error "LV_DRAW_SW_ASM_VECTOR requires the vector extensions of GCC 9+ or clang"
+#endif
+
+#if LV_BIG_ENDIAN_SYSTEM
+#error "LV_DRAW_SW_ASM_VECTOR supports only little endian systems"
+#endif
+
+#include "../../../../misc/lv_color.h"
+#include "../lv_draw_sw_blend_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Pixels processed at once. 8 x 16 bit fits into a 128 bit NEON, SSE or RVV register*/
+#define LV_BLEND_VECTOR_LANES   8
+
+/*The kernels are specialized by the constant arguments of the hooks only if they are inlined*/
+#define LV_BLEND_VECTOR_INLINE static inline __attribute__((always_inline))
+
+/* The kernels are written with the target independent vector extensions of the compiler
+ * which are lowered to the SIMD instructions of the target (or to scalar code if there are none).
+ * They reproduce the results of the C implementations bit by bit.
+ * Only the NORMAL blend mode to RGB565 is accelerated,
+ * i.e. the loops of `lv_color_16_16_mix()`, `lv_color_8_16_mix()` and `lv_color_24_16_mix()`.
+ * The plain fill and the RGB565 to RGB565 copy are not hooked as they are memory bound anyway.
+ * 3 bytes RGB888 pixels can't be loaded efficiently in a portable way so their hooks return LV_RESULT_INVALID.*/
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_OPA(dsc) \
+    lv_color_blend_to_rgb565_vector(dsc, LV_BLEND_VECTOR_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_WITH_MASK(dsc) \
+    lv_color_blend_to_rgb565_vector(dsc, LV_BLEND_VECTOR_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_COLOR_BLEND_TO_RGB565_MIX_MASK_OPA(dsc) \
+    lv_color_blend_to_rgb565_vector(dsc, LV_BLEND_VECTOR_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_L8, LV_BLEND_VECTOR_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_L8, LV_BLEND_VECTOR_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_L8, LV_BLEND_VECTOR_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_L8_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_L8, LV_BLEND_VECTOR_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_AL88, LV_BLEND_VECTOR_MIX_ALPHA)
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_AL88, LV_BLEND_VECTOR_MIX_ALPHA_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_AL88, LV_BLEND_VECTOR_MIX_ALPHA_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_AL88_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_AL88, LV_BLEND_VECTOR_MIX_ALPHA_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_RGB565, LV_BLEND_VECTOR_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_RGB565, LV_BLEND_VECTOR_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB565_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_RGB565, LV_BLEND_VECTOR_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_vector(dsc, src_px_size, LV_BLEND_VECTOR_MIX_NONE)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_vector(dsc, src_px_size, LV_BLEND_VECTOR_MIX_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_vector(dsc, src_px_size, LV_BLEND_VECTOR_MIX_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_RGB888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc, src_px_size)  \
+    lv_rgb888_blend_normal_to_rgb565_vector(dsc, src_px_size, LV_BLEND_VECTOR_MIX_MASK_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_XRGB8888, LV_BLEND_VECTOR_MIX_ALPHA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_XRGB8888, LV_BLEND_VECTOR_MIX_ALPHA_OPA)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_WITH_MASK(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_XRGB8888, LV_BLEND_VECTOR_MIX_ALPHA_MASK)
+#endif
+
+#ifndef LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA
+#define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(dsc)  \
+    lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_XRGB8888, LV_BLEND_VECTOR_MIX_ALPHA_MASK_OPA)
+#endif
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef uint8_t lv_blend_vector_u8_t __attribute__((vector_size(LV_BLEND_VECTOR_LANES)));
+typedef uint16_t lv_blend_vector_u16_t __attribute__((vector_size(LV_BLEND_VECTOR_LANES * 2)));
+typedef int16_t lv_blend_vector_i16_t __attribute__((vector_size(LV_BLEND_VECTOR_LANES * 2)));
+typedef uint32_t lv_blend_vector_u32_t __attribute__((vector_size(LV_BLEND_VECTOR_LANES * 4)));
+
+/**
+ * How to calculate the mix value of the pixels
+ */
+typedef enum {
+    LV_BLEND_VECTOR_MIX_NONE,             /**< Cover: mix = 255*/
+    LV_BLEND_VECTOR_MIX_OPA,              /**< mix = opa*/
+    LV_BLEND_VECTOR_MIX_MASK,             /**< mix = mask*/
+    LV_BLEND_VECTOR_MIX_MASK_OPA,         /**< mix = LV_OPA_MIX2(mask, opa)*/
+    LV_BLEND_VECTOR_MIX_ALPHA,            /**< mix = alpha of the source pixel*/
+    LV_BLEND_VECTOR_MIX_ALPHA_OPA,        /**< mix = LV_OPA_MIX2(alpha, opa)*/
+    LV_BLEND_VECTOR_MIX_ALPHA_MASK,       /**< mix = LV_OPA_MIX2(alpha, mask)*/
+    LV_BLEND_VECTOR_MIX_ALPHA_MASK_OPA,   /**< mix = LV_OPA_MIX3(alpha, mask, opa)*/
+} lv_blend_vector_mix_t;
+
+/**
+ * Source of the RGB565 kernels
+ */
+typedef enum {
+    LV_BLEND_VECTOR_SRC_COLOR,            /**< A single color*/
+    LV_BLEND_VECTOR_SRC_RGB565,           /**< RGB565 pixels*/
+    LV_BLEND_VECTOR_SRC_L8,               /**< L8 pixels*/
+    LV_BLEND_VECTOR_SRC_AL88,             /**< AL88 pixels*/
+    LV_BLEND_VECTOR_SRC_XRGB8888,         /**< XRGB8888 or ARGB8888 pixels*/
+} lv_blend_vector_src_t;
+
+/**********************
+ *  STATIC FUNCTIONS
+ **********************/
+
+LV_BLEND_VECTOR_INLINE uint32_t lv_blend_vector_src_px_size(lv_blend_vector_src_t src_type)
+{
+    switch(src_type) {
+        case LV_BLEND_VECTOR_SRC_RGB565:
+        case LV_BLEND_VECTOR_SRC_AL88:
+            return 2;
+        case LV_BLEND_VECTOR_SRC_L8:
+            return 1;
+        case LV_BLEND_VECTOR_SRC_XRGB8888:
+            return 4;
+        case LV_BLEND_VECTOR_SRC_COLOR:
+        default:
+            return 0;
+    }
+}
+
+LV_BLEND_VECTOR_INLINE bool lv_blend_vector_mix_has_mask(lv_blend_vector_mix_t mode)
+{
+    return mode == LV_BLEND_VECTOR_MIX_MASK || mode == LV_BLEND_VECTOR_MIX_MASK_OPA ||
+           mode == LV_BLEND_VECTOR_MIX_ALPHA_MASK || mode == LV_BLEND_VECTOR_MIX_ALPHA_MASK_OPA;
+}
+
+/**
+ * Set all lanes to the same value
+ */
+LV_BLEND_VECTOR_INLINE lv_blend_vector_u16_t lv_blend_vector_splat(uint16_t v)
+{
+    lv_blend_vector_u16_t res = {0};
+    return res + v;
+}
+
+/**
+ * Load 8 bit values into 16 bit lanes
+ */
+LV_BLEND_VECTOR_INLINE lv_blend_vector_u16_t lv_blend_vector_load_u8(const uint8_t * p)
+{
+    lv_blend_vector_u8_t v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return __builtin_convertvector(v, lv_blend_vector_u16_t);
+}
+
+/**
+ * Select `a` where `sel` is set (all 1 bits) and `b` elsewhere
+ */
+LV_BLEND_VECTOR_INLINE lv_blend_vector_u16_t lv_blend_vector_select(lv_blend_vector_i16_t sel,
+                                                                    lv_blend_vector_u16_t a, lv_blend_vector_u16_t b)
+{
+    lv_blend_vector_u16_t m = (lv_blend_vector_u16_t)sel;
+    return (a & m) | (b & ~m);
+}
+
+/**
+ * Calculate the mix values.
+ * @param mode      how to calculate the mix
+ * @param alpha     alpha of the source pixels (used only by the `LV_BLEND_VECTOR_MIX_ALPHA...` modes)
+ * @param mask      mask values (used only by the `..._MASK...` modes)
+ * @param opa       the opacity
+ * @return          the mix values (0..255)
+ */
+LV_BLEND_VECTOR_INLINE lv_blend_vector_u16_t lv_blend_vector_get_mix(lv_blend_vector_mix_t mode,
+                                                                     lv_blend_vector_u16_t alpha,
+                                                                     lv_blend_vector_u16_t mask, uint16_t opa)
+{
+    lv_blend_vector_u16_t am;
+    switch(mode) {
+        case LV_BLEND_VECTOR_MIX_OPA:
+            return lv_blend_vector_splat(opa);
+        case LV_BLEND_VECTOR_MIX_MASK:
+            return mask;
+        case LV_BLEND_VECTOR_MIX_MASK_OPA:
+            return (mask * opa) >> 8;
+        case LV_BLEND_VECTOR_MIX_ALPHA:
+            return alpha;
+        case LV_BLEND_VECTOR_MIX_ALPHA_OPA:
+            return (alpha * opa) >> 8;
+        case LV_BLEND_VECTOR_MIX_ALPHA_MASK:
+            return (alpha * mask) >> 8;
+        case LV_BLEND_VECTOR_MIX_ALPHA_MASK_OPA:
+            /*`(am * opa) >> 16` without leaving the 16 bit lanes: split `am` to its high and low bytes*/
+            am = alpha * mask;
+            return ((am >> 8) * opa + (((am & 0xFF) * opa) >> 8)) >> 8;
+        case LV_BLEND_VECTOR_MIX_NONE:
+        default:
+            return lv_blend_vector_splat(255);
+    }
+}
+
+/**
+ * Mix RGB565 pixels like `lv_color_16_16_mix()`.
+ * It's equal to `bg + (((fg - bg) * ((mix + 4) >> 3)) >> 5)` on each channel with arithmetic shift.
+ */
+LV_BLEND_VECTOR_INLINE lv_blend_vector_u16_t lv_blend_vector_mix_16_16(lv_blend_vector_u16_t fg,
+                                                                       lv_blend_vector_u16_t bg,
+                                                                       lv_blend_vector_u16_t mix)
+{
+    lv_blend_vector_i16_t m = (lv_blend_vector_i16_t)((mix + 4) >> 3);
+
+    lv_blend_vector_i16_t bg_r = (lv_blend_vector_i16_t)(bg >> 11);
+    lv_blend_vector_i16_t bg_g = (lv_blend_vector_i16_t)((bg >> 5) & 0x3F);
+    lv_blend_vector_i16_t bg_b = (lv_blend_vector_i16_t)(bg & 0x1F);
+
+    lv_blend_vector_i16_t r = bg_r + ((((lv_blend_vector_i16_t)(fg >> 11) - bg_r) * m) >> 5);
+    lv_blend_vector_i16_t g = bg_g + ((((lv_blend_vector_i16_t)((fg >> 5) & 0x3F) - bg_g) * m) >> 5);
+    lv_blend_vector_i16_t b = bg_b + ((((lv_blend_vector_i16_t)(fg & 0x1F) - bg_b) * m) >> 5);
+
+    lv_blend_vector_u16_t res = ((lv_blend_vector_u16_t)r << 11) | ((lv_blend_vector_u16_t)g << 5) |
+                                (lv_blend_vector_u16_t)b;
+    return lv_blend_vector_select(mix == 255, fg, res);
+}
+
+/**
+ * Mix 8 bit channels to RGB565 pixels like `lv_color_24_16_mix()` and `lv_color_8_16_mix()`.
+ */
+LV_BLEND_VECTOR_INLINE lv_blend_vector_u16_t lv_blend_vector_mix_24_16(lv_blend_vector_u16_t red,
+                                                                       lv_blend_vector_u16_t green,
+                                                                       lv_blend_vector_u16_t blue,
+                                                                       lv_blend_vector_u16_t bg,
+                                                                       lv_blend_vector_u16_t mix)
+{
+    lv_blend_vector_u16_t mix_inv = 255 - mix;
+
+    lv_blend_vector_u16_t fg_r = red >> 3;
+    lv_blend_vector_u16_t fg_g = green >> 2;
+    lv_blend_vector_u16_t fg_b = blue >> 3;
+
+    /*At most 63 * 255 so no overflow*/
+    lv_blend_vector_u16_t r = (fg_r * mix + (bg >> 11) * mix_inv) >> 8;
+    lv_blend_vector_u16_t g = (fg_g * mix + ((bg >> 5) & 0x3F) * mix_inv) >> 8;
+    lv_blend_vector_u16_t b = (fg_b * mix + (bg & 0x1F) * mix_inv) >> 8;
+    lv_blend_vector_u16_t res = (r << 11) | (g << 5) | b;
+
+    /*mix == 255 is a plain conversion and mix == 0 keeps the background*/
+    lv_blend_vector_u16_t fg = (fg_r << 11) | (fg_g << 5) | fg_b;
+    res = lv_blend_vector_select(mix == 255, fg, res);
+    return lv_blend_vector_select(mix == 0, bg, res);
+}
+
+/**
+ * Blend `LV_BLEND_VECTOR_LANES` pixels to RGB565
+ * @param dest      the destination pixels
+ * @param src       the source pixels in `src_type` format (not used with `LV_BLEND_VECTOR_SRC_COLOR`)
+ * @param src_type  the format of `src`
+ * @param color16   the color to blend with `LV_BLEND_VECTOR_SRC_COLOR`
+ * @param mask      the mask values (used only by the `..._MASK...` modes)
+ * @param opa       the opacity
+ * @param mode      how to calculate the mix
+ */
+LV_BLEND_VECTOR_INLINE void lv_blend_vector_rgb565_step(uint16_t * dest, const uint8_t * src,
+                                                        lv_blend_vector_src_t src_type, uint16_t color16,
+                                                        const lv_opa_t * mask, uint16_t opa,
+                                                        lv_blend_vector_mix_t mode)
+{
+    lv_blend_vector_u16_t bg;
+    __builtin_memcpy(&bg, dest, sizeof(bg));
+
+    lv_blend_vector_u16_t mask_v = {0};
+    if(lv_blend_vector_mix_has_mask(mode)) mask_v = lv_blend_vector_load_u8(mask);
+
+    lv_blend_vector_u16_t fg = {0};
+    lv_blend_vector_u16_t red = {0};
+    lv_blend_vector_u16_t green = {0};
+    lv_blend_vector_u16_t blue = {0};
+    lv_blend_vector_u16_t alpha = {0};
+    lv_blend_vector_u16_t v;
+    lv_blend_vector_u32_t v32;
+
+    switch(src_type) {
+        case LV_BLEND_VECTOR_SRC_COLOR:
+            fg = lv_blend_vector_splat(color16);
+            break;
+        case LV_BLEND_VECTOR_SRC_RGB565:
+            __builtin_memcpy(&fg, src, sizeof(fg));
+            break;
+        case LV_BLEND_VECTOR_SRC_L8:
+            red = lv_blend_vector_load_u8(src);
+            green = red;
+            blue = red;
+            break;
+        case LV_BLEND_VECTOR_SRC_AL88:
+            __builtin_memcpy(&v, src, sizeof(v));
+            red = v & 0xFF;
+            green = red;
+            blue = red;
+            alpha = v >> 8;
+            break;
+        case LV_BLEND_VECTOR_SRC_XRGB8888:
+            __builtin_memcpy(&v32, src, sizeof(v32));
+            blue = __builtin_convertvector(v32 & 0xFF, lv_blend_vector_u16_t);
+            green = __builtin_convertvector((v32 >> 8) & 0xFF, lv_blend_vector_u16_t);
+            red = __builtin_convertvector((v32 >> 16) & 0xFF, lv_blend_vector_u16_t);
+            alpha = __builtin_convertvector(v32 >> 24, lv_blend_vector_u16_t);
+            break;
+    }
+
+    lv_blend_vector_u16_t res;
+    if(src_type == LV_BLEND_VECTOR_SRC_COLOR || src_type == LV_BLEND_VECTOR_SRC_RGB565) {
+        res = lv_blend_vector_mix_16_16(fg, bg, lv_blend_vector_get_mix(mode, alpha, mask_v, opa));
+    }
+    else if(mode == LV_BLEND_VECTOR_MIX_NONE) {
+        res = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+    }
+    else {
+        res = lv_blend_vector_mix_24_16(red, green, blue, bg, lv_blend_vector_get_mix(mode, alpha, mask_v, opa));
+    }
+
+    __builtin_memcpy(dest, &res, sizeof(res));
+}
+
+/**
+ * Blend a line to RGB565. See `lv_blend_vector_rgb565_step()` for the parameters.
+ */
+LV_BLEND_VECTOR_INLINE void lv_blend_vector_rgb565_line(uint16_t * dest, const uint8_t * src,
+                                                        lv_blend_vector_src_t src_type, uint16_t color16,
+                                                        const lv_opa_t * mask, lv_opa_t opa,
+                                                        lv_blend_vector_mix_t mode, int32_t w)
+{
+    const uint32_t src_px_size = lv_blend_vector_src_px_size(src_type);
+    int32_t x;
+    for(x = 0; x <= w - LV_BLEND_VECTOR_LANES; x += LV_BLEND_VECTOR_LANES) {
+        lv_blend_vector_rgb565_step(&dest[x], src ? &src[x * src_px_size] : NULL, src_type, color16,
+                                    mask ? &mask[x] : NULL, opa, mode);
+    }
+
+    /*Process the last pixels in a temporary buffer*/
+    if(x < w) {
+        uint16_t dest_tmp[LV_BLEND_VECTOR_LANES] = {0};
+        uint8_t src_tmp[LV_BLEND_VECTOR_LANES * 4] = {0};
+        lv_opa_t mask_tmp[LV_BLEND_VECTOR_LANES] = {0};
+        int32_t n = w - x;
+        __builtin_memcpy(dest_tmp, &dest[x], n * sizeof(uint16_t));
+        if(src) __builtin_memcpy(src_tmp, &src[x * src_px_size], n * src_px_size);
+        if(mask) __builtin_memcpy(mask_tmp, &mask[x], n);
+        lv_blend_vector_rgb565_step(dest_tmp, src_tmp, src_type, color16, mask_tmp, opa, mode);
+        __builtin_memcpy(&dest[x], dest_tmp, n * sizeof(uint16_t));
+    }
+}
+
+/*=====================
+ * RGB565 destination
+ *====================*/
+
+LV_BLEND_VECTOR_INLINE lv_result_t lv_color_blend_to_rgb565_vector(lv_draw_sw_blend_fill_dsc_t * dsc,
+                                                                   lv_blend_vector_mix_t mode)
+{
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint8_t * dest = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t y;
+
+    for(y = 0; y < dsc->dest_h; y++) {
+        lv_blend_vector_rgb565_line((uint16_t *)dest, NULL, LV_BLEND_VECTOR_SRC_COLOR, color16, mask, dsc->opa, mode,
+                                    dsc->dest_w);
+        dest += dsc->dest_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_VECTOR_INLINE lv_result_t lv_blend_vector_image_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                   lv_blend_vector_src_t src_type,
+                                                                   lv_blend_vector_mix_t mode)
+{
+    uint8_t * dest = dsc->dest_buf;
+    const uint8_t * src = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    int32_t y;
+
+    for(y = 0; y < dsc->dest_h; y++) {
+        lv_blend_vector_rgb565_line((uint16_t *)dest, src, src_type, 0, mask, dsc->opa, mode, dsc->dest_w);
+        dest += dsc->dest_stride;
+        src += dsc->src_stride;
+        if(mask) mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+LV_BLEND_VECTOR_INLINE lv_result_t lv_rgb888_blend_normal_to_rgb565_vector(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                           uint32_t src_px_size,
+                                                                           lv_blend_vector_mix_t mode)
+{
+    if(src_px_size != 4) return LV_RESULT_INVALID;
+
+    /*The alpha channel is not used so it's the same as ARGB8888 but with the given mix*/
+    return lv_blend_vector_image_to_rgb565(dsc, LV_BLEND_VECTOR_SRC_XRGB8888, mode);
+}
+
+#endif /*LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_VECTOR*/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_BLEND_VECTOR_H*/
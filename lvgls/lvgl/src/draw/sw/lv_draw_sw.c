@@ -8,6 +8,7 @@
  *********************/
 #include "lv_draw_sw_private.h"
 #include "../lv_draw_private.h"
+#include "../../misc/lv_area_private.h"
 #if LV_USE_DRAW_SW
 
 #include "../../core/lv_refr.h"
@@ -102,6 +103,10 @@
 #endif
 
 static void execute_drawing(lv_draw_sw_unit_t * u);
+#if LV_DRAW_SW_USE_BAND_SPLIT
+    static bool band_job_start(lv_draw_sw_unit_t * u);
+    static bool band_job_render(lv_draw_sw_unit_t * u);
+#endif
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -152,6 +157,12 @@ static void rotate270_l8(const uint8_t * src, uint8_t * dst, int32_t src_width,
  *  STATIC VARIABLES
  **********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
+#if LV_DRAW_SW_USE_BAND_SPLIT
+    #define _band_job LV_GLOBAL_DEFAULT()->sw_band_job
+
+    /*Minimal height of a band [px]*/
+    #define BAND_MIN_HEIGHT 8
+#endif
 
 /**********************
  *      MACROS
@@ -166,6 +177,13 @@ void lv_draw_sw_init(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_init();
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_draw_sw_shadow_cache_init();
+#endif
+#endif
+
+#if LV_DRAW_SW_USE_BAND_SPLIT
+    lv_mutex_init(&_band_job.lock);
 #endif
 
     uint32_t i;
@@ -194,6 +212,13 @@ void lv_draw_sw_deinit(void)
 
 #if LV_DRAW_SW_COMPLEX == 1
     lv_draw_sw_mask_deinit();
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    lv_draw_sw_shadow_cache_deinit();
+#endif
+#endif
+
+#if LV_DRAW_SW_USE_BAND_SPLIT
+    lv_mutex_delete(&_band_job.lock);
 #endif
 }
 
@@ -380,7 +405,11 @@ void lv_draw_sw_rotate(const void * src, void * dest, int32_t src_width, int32_t
  **********************/
 static inline void execute_drawing_unit(lv_draw_sw_unit_t * u)
 {
+#if LV_DRAW_SW_USE_BAND_SPLIT
+    if(!band_job_start(u)) execute_drawing(u);
+#else
     execute_drawing(u);
+#endif
 
     u->task_act->state = LV_DRAW_TASK_STATE_READY;
     u->task_act = NULL;
@@ -479,6 +508,10 @@ static void render_thread_cb(void * ptr)
             if(u->exit_status) {
                 break;
             }
+#if LV_DRAW_SW_USE_BAND_SPLIT
+            /*Help rendering a large draw task while idle*/
+            if(band_job_render(u)) continue;
+#endif
             lv_thread_sync_wait(&u->sync);
         }
 
@@ -496,6 +529,130 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
+#if LV_DRAW_SW_USE_BAND_SPLIT
+
+/**
+ * If the task of the draw unit is large enough split it into bands
+ * and render them together with the idle draw units.
+ * @param u     pointer to a draw unit with a task to render
+ * @return      true: the task was rendered in bands; false: the task needs to be rendered normally
+ */
+static bool band_job_start(lv_draw_sw_unit_t * u)
+{
+    lv_draw_task_t * t = u->task_act;
+
+    if(t->type == LV_DRAW_TASK_TYPE_IMAGE) {
+        /*Other image sources would be decoded for each band*/
+        lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+        if(lv_image_src_get_type(draw_dsc->src) != LV_IMAGE_SRC_VARIABLE) return false;
+    }
+    else if(t->type != LV_DRAW_TASK_TYPE_FILL && t->type != LV_DRAW_TASK_TYPE_LAYER) {
+        return false;
+    }
+
+    lv_area_t area;
+    if(!lv_area_intersect(&area, &t->_real_area, &t->clip_area)) return false;
+    if(lv_area_get_size(&area) < LV_DRAW_SW_BAND_SPLIT_MIN_AREA) return false;
+
+    int32_t h = lv_area_get_height(&area);
+    uint32_t band_cnt = LV_MIN(LV_DRAW_SW_DRAW_UNIT_CNT * 2, h / BAND_MIN_HEIGHT);
+    if(band_cnt < 2) return false;
+
+    lv_draw_sw_band_job_t * job = &_band_job;
+    lv_mutex_lock(&job->lock);
+    /*Only one task can be split at a time*/
+    if(job->task) {
+        lv_mutex_unlock(&job->lock);
+        return false;
+    }
+
+    LV_PROFILER_BEGIN;
+    job->task = t;
+    job->owner = u;
+    job->area = area;
+    job->band_h = (h + band_cnt - 1) / band_cnt;
+    job->band_cnt = (h + job->band_h - 1) / job->band_h;
+    job->band_next = 0;
+    job->band_done = 0;
+    lv_mutex_unlock(&job->lock);
+
+    /*Wake up the idle draw units to take bands*/
+    lv_draw_unit_t * draw_unit = _draw_info.unit_head;
+    while(draw_unit) {
+        lv_draw_sw_unit_t * sw_unit = (lv_draw_sw_unit_t *)draw_unit;
+        if(draw_unit->dispatch_cb == dispatch && sw_unit != u && sw_unit->inited && sw_unit->task_act == NULL) {
+            lv_thread_sync_signal(&sw_unit->sync);
+        }
+        draw_unit = draw_unit->next;
+    }
+
+    band_job_render(u);
+
+    /*Wait for the bands taken by the other draw units*/
+    while(1) {
+        lv_mutex_lock(&job->lock);
+        bool finished = job->band_done == job->band_cnt;
+        if(finished) job->task = NULL;
+        lv_mutex_unlock(&job->lock);
+        if(finished) break;
+
+        lv_thread_sync_wait(&u->sync);
+    }
+
+    LV_PROFILER_END;
+    return true;
+}
+
+/**
+ * Take bands of the current band job and render them until there are no more bands left.
+ * @param u     pointer to a draw unit
+ * @return      true: at least one band was rendered
+ */
+static bool band_job_render(lv_draw_sw_unit_t * u)
+{
+    lv_draw_sw_band_job_t * job = &_band_job;
+    bool rendered = false;
+
+    while(1) {
+        lv_mutex_lock(&job->lock);
+        if(job->task == NULL || job->band_next >= job->band_cnt) {
+            lv_mutex_unlock(&job->lock);
+            break;
+        }
+
+        lv_area_t band_area = job->area;
+        band_area.y1 += job->band_next * job->band_h;
+        band_area.y2 = LV_MIN(band_area.y1 + job->band_h - 1, job->area.y2);
+        job->band_next++;
+
+        /*Render with a separate draw unit as the dispatcher might assign a new task to `u` meanwhile*/
+        lv_draw_sw_unit_t band_unit;
+        lv_memzero(&band_unit, sizeof(band_unit));
+        band_unit.base_unit.target_layer = job->owner->base_unit.target_layer;
+        band_unit.base_unit.clip_area = &band_area;
+        band_unit.task_act = job->task;
+        band_unit.idx = u->idx;
+        lv_mutex_unlock(&job->lock);
+
+        LV_PROFILER_BEGIN_TAG("band_job_render");
+        execute_drawing(&band_unit);
+        LV_PROFILER_END_TAG("band_job_render");
+        rendered = true;
+
+        lv_mutex_lock(&job->lock);
+        job->band_done++;
+        bool last = job->band_done == job->band_cnt;
+        lv_draw_sw_unit_t * owner = job->owner;
+        lv_mutex_unlock(&job->lock);
+
+        if(last && owner != u) lv_thread_sync_signal(&owner->sync);
+    }
+
+    return rendered;
+}
+
+#endif /*LV_DRAW_SW_USE_BAND_SPLIT*/
+
 static void execute_drawing(lv_draw_sw_unit_t * u)
 {
     LV_PROFILER_BEGIN;
@@ -0,0 +1,181 @@
+/**
+ * @file lv_draw_sw_band_bench.c
+ *
+ * Benchmark of splitting the large software draw tasks into bands rendered by several threads.
+ * It's a standalone Linux program which is compiled only if `LV_DRAW_SW_BAND_BENCH` is defined.
+ *
+ * Build it on a host with `LV_USE_OS LV_OS_PTHREAD`. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_DRAW_SW_BAND_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o band_bench
+ *
+ * Usage: `./band_bench [frame_cnt]`
+ *
+ * The screen has a full screen gradient, a large variable image and a semi-transparent
+ * container (a layer) with a few children. The whole screen is redrawn in every frame.
+ * The time of a frame and a hash of the flushed pixels are printed.
+ * Build it with `LV_DRAW_SW_DRAW_UNIT_CNT` 1, 2, 4, ... up to the number of cores to see
+ * how it scales, and with `LV_DRAW_SW_BAND_SPLIT_MIN_AREA 0` to compare it with
+ * rendering whole draw tasks. The hashes should be the same in all builds.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_DRAW_SW_BAND_BENCH
+
+#include "../../../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         800
+#define VER_RES         480
+#define BUF_LINES       120
+#define IMG_W           480
+#define IMG_H           320
+#define POOL_CNT        ((512 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void image_init(void);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+LV_ATTRIBUTE_MEM_ALIGN static uint8_t draw_buf[HOR_RES * BUF_LINES * 2];
+LV_ATTRIBUTE_MEM_ALIGN static uint8_t img_px[IMG_W * IMG_H * 4];
+static lv_image_dsc_t img_dsc;
+static uint32_t tick;
+static uint32_t hash;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frame_cnt = argc > 1 ? atoi(argv[1]) : 50;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0x80a0c0), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+
+    image_init();
+    lv_obj_t * img = lv_image_create(scr);
+    lv_image_set_src(img, &img_dsc);
+    lv_obj_set_pos(img, 20, 20);
+
+    /*Rendered on a layer because of the opacity*/
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, 500, 300);
+    lv_obj_set_pos(cont, 280, 160);
+    lv_obj_set_style_opa(cont, LV_OPA_70, 0);
+    for(i = 0; i < 6; i++) {
+        lv_obj_t * btn = lv_button_create(cont);
+        lv_obj_set_size(btn, 140, 60);
+        lv_obj_set_pos(btn, (i % 3) * 155, (i / 3) * 120);
+    }
+
+    /*Draw the first frame to create everything*/
+    lv_refr_now(disp);
+
+    /*FNV-1a*/
+    hash = 2166136261u;
+    double t_start = now_ms();
+    for(i = 0; i < frame_cnt; i++) {
+        lv_obj_invalidate(scr);
+        tick += 33;
+        lv_refr_now(disp);
+    }
+    double t_frames = now_ms() - t_start;
+
+    printf("draw units: %d, band split area: %d, %.3f ms/frame, hash: %08"LV_PRIx32"\n",
+           LV_DRAW_SW_DRAW_UNIT_CNT, LV_DRAW_SW_BAND_SPLIT_MIN_AREA, t_frames / frame_cnt, hash);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Fill the image with a semi-transparent pattern
+ */
+static void image_init(void)
+{
+    uint32_t x;
+    uint32_t y;
+    uint8_t * px = img_px;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            px[0] = (uint8_t)(x * 255 / IMG_W);
+            px[1] = (uint8_t)(y * 255 / IMG_H);
+            px[2] = (uint8_t)((x ^ y) & 0xff);
+            px[3] = (uint8_t)(128 + ((x + y) & 0x7f));
+            px += 4;
+        }
+    }
+
+    img_dsc.header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_dsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+    img_dsc.header.w = IMG_W;
+    img_dsc.header.h = IMG_H;
+    img_dsc.header.stride = IMG_W * 4;
+    img_dsc.data_size = sizeof(img_px);
+    img_dsc.data = img_px;
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    uint32_t size = lv_area_get_size(area) * 2;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        hash = (hash ^ px_map[i]) * 16777619u;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return tick;
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_DRAW_SW_BAND_BENCH*/
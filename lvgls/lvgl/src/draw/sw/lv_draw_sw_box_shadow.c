@@ -21,6 +21,8 @@
 #include "../../misc/lv_assert.h"
 #include "../../stdlib/lv_string.h"
 #include "../lv_draw_mask.h"
+#include "../../misc/cache/lv_cache_private.h"
+#include "lv_draw_sw_private.h"
 
 /*********************
  *      DEFINES
@@ -28,20 +30,39 @@
 #define SHADOW_UPSCALE_SHIFT    6
 #define SHADOW_ENHANCE          1
 
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    #define shadow_cache LV_GLOBAL_DEFAULT()->sw_shadow_cache
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+    #define shadow_cache_p LV_GLOBAL_DEFAULT()->sw_shadow_cache
 #endif
 
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+/** A blurred shadow corner in the shadow cache. The corner size is `width + r`.*/
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t width;              /**< Width of the shadow*/
+    int32_t r;                  /**< Clamped radius*/
+    int32_t area_w;             /**< Width of the blurred area, at most `width + 2 * r`*/
+    int32_t area_h;             /**< Height of the blurred area, at most `width + 2 * r`*/
+    lv_opa_t * buf;             /**< `(width + r)^2` opacity values*/
+} shadow_cache_entry_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_draw_corner_buf(const lv_area_t * coords, uint16_t * sh_buf, int32_t s,
                                                                int32_t r);
 static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t sw, uint16_t * sh_ups_buf);
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+static lv_opa_t * shadow_cache_get_corner(const lv_area_t * core_area, int32_t width, int32_t r);
+static bool shadow_cache_create_cb(shadow_cache_entry_t * node, void * user_data);
+static void shadow_cache_free_cb(shadow_cache_entry_t * node, void * user_data);
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_entry_t * lhs,
+                                                      const shadow_cache_entry_t * rhs);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,6 +76,30 @@ static void /* LV_ATTRIBUTE_FAST_MEM */ shadow_blur_corner(int32_t size, int32_t
  *   GLOBAL FUNCTIONS
  **********************/
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+void lv_draw_sw_shadow_cache_init(void)
+{
+    if(shadow_cache_p != NULL) return;
+
+    shadow_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(shadow_cache_entry_t), LV_DRAW_SW_SHADOW_CACHE_MEM, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) shadow_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) shadow_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) shadow_cache_free_cb
+    });
+
+    if(shadow_cache_p) lv_cache_set_name(shadow_cache_p, "SW_SHADOW");
+}
+
+void lv_draw_sw_shadow_cache_deinit(void)
+{
+    if(shadow_cache_p == NULL) return;
+
+    lv_cache_destroy(shadow_cache_p, NULL);
+    shadow_cache_p = NULL;
+}
+#endif
+
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
 {
     /*Calculate the rectangle which is blurred to get the shadow in `shadow_area`*/
@@ -100,24 +145,7 @@ void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_
     lv_opa_t * sh_buf;
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
-    lv_draw_sw_shadow_cache_t * cache = &shadow_cache;
-    if(cache->cache_size == corner_size && cache->cache_r == r_sh) {
-        /*Use the cache if available*/
-        sh_buf = lv_malloc(corner_size * corner_size);
-        lv_memcpy(sh_buf, cache->cache, corner_size * corner_size);
-    }
-    else {
-        /*A larger buffer is required for calculation*/
-        sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
-        shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
-
-        /*Cache the corner if it fits into the cache size*/
-        if((uint32_t)corner_size * corner_size < sizeof(cache->cache)) {
-            lv_memcpy(cache->cache, sh_buf, corner_size * corner_size);
-            cache->cache_size = corner_size;
-            cache->cache_r = r_sh;
-        }
-    }
+    sh_buf = shadow_cache_get_corner(&core_area, dsc->width, r_sh);
 #else
     sh_buf = lv_malloc(corner_size * corner_size * sizeof(uint16_t));
     shadow_draw_corner_buf(&core_area, (uint16_t *)sh_buf, dsc->width, r_sh);
@@ -727,6 +755,100 @@ static void LV_ATTRIBUTE_FAST_MEM shadow_blur_corner(int32_t size, int32_t sw, u
     lv_free(sh_ups_blur_buf);
 }
 
+#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+
+/**
+ * Get the blurred corner of a shadow from the cache or calculate it and add it to the cache.
+ * @param core_area     the area to blur
+ * @param width         width of the shadow
+ * @param r             the clamped radius
+ * @return              `(width + r)^2` opacity values in a new buffer which needs to be freed with `lv_free()`.
+ *                      It's a copy as the corner is mirrored in place while drawing.
+ */
+static lv_opa_t * shadow_cache_get_corner(const lv_area_t * core_area, int32_t width, int32_t r)
+{
+    int32_t corner_size = width + r;
+    uint32_t buf_size = corner_size * corner_size;
+    bool cacheable = shadow_cache_p && corner_size <= LV_DRAW_SW_SHADOW_CACHE_SIZE;
+
+    /*The far sides of the area affect the corner only if they are closer than the corner*/
+    shadow_cache_entry_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.width = width;
+    search_key.r = r;
+    search_key.area_w = LV_MIN(lv_area_get_width(core_area), corner_size + r);
+    search_key.area_h = LV_MIN(lv_area_get_height(core_area), corner_size + r);
+
+    if(cacheable) {
+        lv_cache_entry_t * entry = lv_cache_acquire(shadow_cache_p, &search_key, NULL);
+        if(entry) {
+            lv_opa_t * sh_buf = lv_malloc(buf_size);
+            LV_ASSERT_MALLOC(sh_buf);
+            if(sh_buf) lv_memcpy(sh_buf, ((shadow_cache_entry_t *)lv_cache_entry_get_data(entry))->buf, buf_size);
+            lv_cache_release(shadow_cache_p, entry, NULL);
+            return sh_buf;
+        }
+    }
+
+    /*A larger buffer is required for calculation*/
+    lv_opa_t * sh_buf = lv_malloc(buf_size * sizeof(uint16_t));
+    LV_ASSERT_MALLOC(sh_buf);
+    shadow_draw_corner_buf(core_area, (uint16_t *)sh_buf, width, r);
+
+    search_key.slot.size = sizeof(shadow_cache_entry_t) + buf_size;
+    if(!cacheable || search_key.slot.size > lv_cache_get_max_size(shadow_cache_p, NULL)) return sh_buf;
+
+    search_key.buf = lv_malloc(buf_size);
+    if(search_key.buf == NULL) return sh_buf;
+    lv_memcpy(search_key.buf, sh_buf, buf_size);
+
+    /*Calculated outside of the cache's lock so another thread might have added it in the meantime*/
+    bool added = false;
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(shadow_cache_p, &search_key, &added);
+    if(entry) lv_cache_release(shadow_cache_p, entry, NULL);
+    if(!added) lv_free(search_key.buf);
+
+    return sh_buf;
+}
+
+static bool shadow_cache_create_cb(shadow_cache_entry_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+
+    /*The corner is already calculated. The cache has taken over its memory.*/
+    bool * added = user_data;
+    *added = true;
+    return true;
+}
+
+static void shadow_cache_free_cb(shadow_cache_entry_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(node->buf);
+}
+
+static lv_cache_compare_res_t shadow_cache_compare_cb(const shadow_cache_entry_t * lhs,
+                                                      const shadow_cache_entry_t * rhs)
+{
+    if(lhs->width != rhs->width) {
+        return lhs->width > rhs->width ? 1 : -1;
+    }
+    if(lhs->r != rhs->r) {
+        return lhs->r > rhs->r ? 1 : -1;
+    }
+    if(lhs->area_w != rhs->area_w) {
+        return lhs->area_w > rhs->area_w ? 1 : -1;
+    }
+    if(lhs->area_h != rhs->area_h) {
+        return lhs->area_h > rhs->area_h ? 1 : -1;
+    }
+
+    return 0;
+}
+
+#endif /*LV_DRAW_SW_SHADOW_CACHE_SIZE*/
+
 #else /*LV_DRAW_SW_COMPLEX*/
 
 void lv_draw_sw_box_shadow(lv_draw_unit_t * draw_unit, const lv_draw_box_shadow_dsc_t * dsc, const lv_area_t * coords)
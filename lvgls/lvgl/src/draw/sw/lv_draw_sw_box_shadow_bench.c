@@ -0,0 +1,137 @@
+/**
+ * @file lv_draw_sw_box_shadow_bench.c
+ *
+ * Benchmark of the software box shadow with a grid of cards.
+ * It's a standalone program which is compiled only if `LV_DRAW_SW_BOX_SHADOW_BENCH` is defined.
+ *
+ * Build it on a host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_DRAW_SW_BOX_SHADOW_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o shadow_bench
+ *
+ * Usage: `./shadow_bench [frame_cnt]`
+ *
+ * The cards have 6 different shadows (3 radii and 2 widths), so a single cached corner
+ * would be evicted all the time. The whole screen is redrawn in every frame.
+ * The time of a frame and a hash of the flushed pixels are printed.
+ * Build it with `LV_DRAW_SW_SHADOW_CACHE_SIZE 0` and e.g. `LV_DRAW_SW_SHADOW_CACHE_SIZE 64`
+ * to compare the speed. The hashes should be the same.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_DRAW_SW_BOX_SHADOW_BENCH
+
+#include "../../../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         800
+#define VER_RES         480
+#define CARD_CNT        24
+#define POOL_CNT        ((512 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint8_t draw_buf[HOR_RES * 40 * 2];
+static uint32_t tick;
+static uint32_t hash;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frame_cnt = argc > 1 ? atoi(argv[1]) : 100;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_screen_active();
+    static const int32_t radii[3] = {4, 12, 20};
+    for(i = 0; i < CARD_CNT; i++) {
+        lv_obj_t * card = lv_obj_create(scr);
+        lv_obj_set_size(card, 160, 90);
+        lv_obj_set_pos(card, 20 + (i % 4) * 190, 15 + (i / 4) * 78);
+        lv_obj_set_style_radius(card, radii[i % 3], 0);
+        lv_obj_set_style_shadow_width(card, 16 + (i % 2) * 8, 0);
+        lv_obj_set_style_shadow_opa(card, LV_OPA_50, 0);
+    }
+
+    /*Draw the first frame to create everything*/
+    lv_refr_now(disp);
+
+    /*FNV-1a*/
+    hash = 2166136261u;
+    double t_start = now_ms();
+    for(i = 0; i < frame_cnt; i++) {
+        lv_obj_invalidate(scr);
+        tick += 33;
+        lv_refr_now(disp);
+    }
+    double t_frames = now_ms() - t_start;
+
+    printf("card grid: %.3f ms/frame, hash: %08"LV_PRIx32"\n", t_frames / frame_cnt, hash);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    uint32_t size = lv_area_get_size(area) * 2;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        hash = (hash ^ px_map[i]) * 16777619u;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return tick;
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_DRAW_SW_BOX_SHADOW_BENCH*/
@@ -21,10 +21,7 @@
 /*********************
  *      DEFINES
  *********************/
-#define CIRCLE_CACHE_LIFE_MAX           1000
-#define CIRCLE_CACHE_AGING(life, r)     life = LV_MIN(life + (r < 16 ? 1 : (r >> 4)), 1000)
-#define circle_cache_mutex              LV_GLOBAL_DEFAULT()->draw_info.circle_cache_mutex
-#define _circle_cache                   LV_GLOBAL_DEFAULT()->sw_circle_cache
+#define circle_cache_p                  LV_GLOBAL_DEFAULT()->sw_circle_cache
 
 /**********************
  *      TYPEDEFS
@@ -62,6 +59,12 @@ static void circ_init(lv_point_t * c, int32_t * tmp, int32_t radius);
 static bool circ_cont(lv_point_t * c);
 static void circ_next(lv_point_t * c, int32_t * tmp);
 static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radius);
+static lv_draw_sw_mask_radius_circle_dsc_t * circle_cache_get(int32_t radius);
+static void circle_cache_release(lv_draw_sw_mask_radius_circle_dsc_t * c);
+static bool circle_cache_create_cb(lv_draw_sw_mask_radius_circle_dsc_t * node, void * user_data);
+static void circle_cache_free_cb(lv_draw_sw_mask_radius_circle_dsc_t * node, void * user_data);
+static lv_cache_compare_res_t circle_cache_compare_cb(const lv_draw_sw_mask_radius_circle_dsc_t * lhs,
+                                                      const lv_draw_sw_mask_radius_circle_dsc_t * rhs);
 static lv_opa_t * get_next_line(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t y, int32_t * len,
                                 int32_t * x_start);
 static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, lv_opa_t mask_new);
@@ -80,12 +83,24 @@ static inline lv_opa_t /* LV_ATTRIBUTE_FAST_MEM */ mask_mix(lv_opa_t mask_act, l
 
 void lv_draw_sw_mask_init(void)
 {
-    lv_mutex_init(&circle_cache_mutex);
+    if(circle_cache_p != NULL || LV_DRAW_SW_CIRCLE_CACHE_MEM == 0) return;
+
+    circle_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_draw_sw_mask_radius_circle_dsc_t), LV_DRAW_SW_CIRCLE_CACHE_MEM, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) circle_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) circle_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) circle_cache_free_cb
+    });
+
+    if(circle_cache_p) lv_cache_set_name(circle_cache_p, "SW_CIRCLE");
 }
 
 void lv_draw_sw_mask_deinit(void)
 {
-    lv_mutex_delete(&circle_cache_mutex);
+    if(circle_cache_p == NULL) return;
+
+    lv_cache_destroy(circle_cache_p, NULL);
+    circle_cache_p = NULL;
 }
 
 lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[], lv_opa_t * mask_buf, int32_t abs_x,
@@ -109,33 +124,14 @@ lv_draw_sw_mask_res_t LV_ATTRIBUTE_FAST_MEM lv_draw_sw_mask_apply(void * masks[]
 
 void lv_draw_sw_mask_free_param(void * p)
 {
-    lv_mutex_lock(&circle_cache_mutex);
     lv_draw_sw_mask_common_dsc_t * pdsc = p;
     if(pdsc->type == LV_DRAW_SW_MASK_TYPE_RADIUS) {
         lv_draw_sw_mask_radius_param_t * radius_p = (lv_draw_sw_mask_radius_param_t *) p;
         if(radius_p->circle) {
-            if(radius_p->circle->life < 0) {
-                lv_free(radius_p->circle->cir_opa);
-                lv_free(radius_p->circle);
-            }
-            else {
-                radius_p->circle->used_cnt--;
-            }
+            circle_cache_release(radius_p->circle);
+            radius_p->circle = NULL;
         }
     }
-
-    lv_mutex_unlock(&circle_cache_mutex);
-}
-
-void lv_draw_sw_mask_cleanup(void)
-{
-    uint8_t i;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].buf) {
-            lv_free(_circle_cache[i].buf);
-        }
-        lv_memzero(&(_circle_cache[i]), sizeof(_circle_cache[i]));
-    }
 }
 
 void lv_draw_sw_mask_line_points_init(lv_draw_sw_mask_line_param_t * param, int32_t p1x, int32_t p1y,
@@ -311,47 +307,32 @@ void lv_draw_sw_mask_radius_init(lv_draw_sw_mask_radius_param_t * param, const l
         return;
     }
 
-    lv_mutex_lock(&circle_cache_mutex);
-
-    uint32_t i;
-
-    /*Try to reuse a circle cache entry*/
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].radius == radius) {
-            _circle_cache[i].used_cnt++;
-            CIRCLE_CACHE_AGING(_circle_cache[i].life, radius);
-            param->circle = &(_circle_cache[i]);
-            lv_mutex_unlock(&circle_cache_mutex);
-            return;
-        }
-    }
-
-    /*If not cached use the free entry with lowest life*/
-    lv_draw_sw_mask_radius_circle_dsc_t * entry = NULL;
-    for(i = 0; i < LV_DRAW_SW_CIRCLE_CACHE_SIZE; i++) {
-        if(_circle_cache[i].used_cnt == 0) {
-            if(!entry) entry = &(_circle_cache[i]);
-            else if(_circle_cache[i].life < entry->life) entry = &(_circle_cache[i]);
-        }
-    }
+    param->circle = circle_cache_get(radius);
+}
 
-    /*There is no unused entry. Allocate one temporarily*/
-    if(!entry) {
-        entry = lv_malloc_zeroed(sizeof(lv_draw_sw_mask_radius_circle_dsc_t));
-        LV_ASSERT_MALLOC(entry);
-        entry->life = -1;
-    }
-    else {
-        entry->used_cnt++;
-        entry->life = 0;
-        CIRCLE_CACHE_AGING(entry->life, radius);
+const lv_opa_t * lv_draw_sw_mask_radius_get_row(const lv_draw_sw_mask_radius_param_t * param, int32_t abs_y,
+                                                int32_t * x_left, int32_t * x_right, int32_t * aa_len)
+{
+    const lv_area_t * rect = &param->cfg.rect;
+    int32_t radius = param->cfg.radius;
+
+    *aa_len = 0;
+    if(param->circle == NULL || (abs_y >= rect->y1 + radius && abs_y <= rect->y2 - radius)) {
+        *x_left = rect->x1;
+        *x_right = rect->x2;
+        return NULL;
     }
 
-    param->circle = entry;
+    int32_t cir_y;
+    if(abs_y < rect->y1 + radius) cir_y = rect->y1 + radius - abs_y - 1;
+    else cir_y = abs_y - (rect->y2 + 1 - radius);
 
-    circ_calc_aa4(param->circle, radius);
-    lv_mutex_unlock(&circle_cache_mutex);
+    int32_t x_start;
+    lv_opa_t * aa_opa = get_next_line(param->circle, cir_y, aa_len, &x_start);
+    *x_left = rect->x1 + radius - x_start - 1;
+    *x_right = rect->x2 + 1 - radius + x_start;
 
+    return aa_opa;
 }
 
 void lv_draw_sw_mask_fade_init(lv_draw_sw_mask_fade_param_t * param, const lv_area_t * coords, lv_opa_t opa_top,
@@ -1068,6 +1049,89 @@ static void circ_next(lv_point_t * c, int32_t * tmp)
     c->y++;
 }
 
+/**
+ * Get the 1/4 circle data of a radius from the circle cache or calculate it.
+ * The arcs, borders, rounded rectangles and shadows use the same radius masks so they share the entries.
+ * @param radius    radius of the circle (> 0)
+ * @return          the circle data, free it with `circle_cache_release()`
+ */
+static lv_draw_sw_mask_radius_circle_dsc_t * circle_cache_get(int32_t radius)
+{
+    lv_draw_sw_mask_radius_circle_dsc_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.radius = radius;
+
+    if(circle_cache_p) {
+        lv_cache_entry_t * entry = lv_cache_acquire(circle_cache_p, &search_key, NULL);
+        if(entry) return lv_cache_entry_get_data(entry);
+    }
+
+    /*Calculated outside of the cache's lock so another thread might add it in the meantime*/
+    circ_calc_aa4(&search_key, radius);
+
+    search_key.slot.size = sizeof(lv_draw_sw_mask_radius_circle_dsc_t) + radius * 6 + 6;
+    if(circle_cache_p && search_key.slot.size <= lv_cache_get_max_size(circle_cache_p, NULL)) {
+        search_key.cached = true;
+        bool added = false;
+        lv_cache_entry_t * entry = lv_cache_acquire_or_create(circle_cache_p, &search_key, &added);
+        if(entry) {
+            if(!added) lv_free(search_key.buf);
+            return lv_cache_entry_get_data(entry);
+        }
+        search_key.cached = false;
+    }
+
+    /*Not cached. Keep it only until the mask is freed*/
+    lv_draw_sw_mask_radius_circle_dsc_t * c = lv_malloc(sizeof(lv_draw_sw_mask_radius_circle_dsc_t));
+    LV_ASSERT_MALLOC(c);
+    if(c == NULL) {
+        lv_free(search_key.buf);
+        return NULL;
+    }
+
+    lv_memcpy(c, &search_key, sizeof(search_key));
+    return c;
+}
+
+static void circle_cache_release(lv_draw_sw_mask_radius_circle_dsc_t * c)
+{
+    if(c->cached) {
+        lv_cache_entry_t * entry = lv_cache_entry_get_entry(c, sizeof(lv_draw_sw_mask_radius_circle_dsc_t));
+        lv_cache_release(circle_cache_p, entry, NULL);
+    }
+    else {
+        lv_free(c->buf);
+        lv_free(c);
+    }
+}
+
+static bool circle_cache_create_cb(lv_draw_sw_mask_radius_circle_dsc_t * node, void * user_data)
+{
+    LV_UNUSED(node);
+
+    /*The circle is already calculated. The cache has taken over its memory.*/
+    bool * added = user_data;
+    *added = true;
+    return true;
+}
+
+static void circle_cache_free_cb(lv_draw_sw_mask_radius_circle_dsc_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free(node->buf);
+}
+
+static lv_cache_compare_res_t circle_cache_compare_cb(const lv_draw_sw_mask_radius_circle_dsc_t * lhs,
+                                                      const lv_draw_sw_mask_radius_circle_dsc_t * rhs)
+{
+    if(lhs->radius != rhs->radius) {
+        return lhs->radius > rhs->radius ? 1 : -1;
+    }
+
+    return 0;
+}
+
 static void circ_calc_aa4(lv_draw_sw_mask_radius_circle_dsc_t * c, int32_t radius)
 {
     if(radius == 0) return;
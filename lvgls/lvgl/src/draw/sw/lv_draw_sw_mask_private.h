@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_draw_sw_mask.h"
+#include "../../misc/cache/lv_cache_private.h"
 
 #if LV_DRAW_SW_COMPLEX
 
@@ -27,13 +28,13 @@ extern "C" {
  **********************/
 
 typedef struct  {
+    lv_cache_slot_size_t slot;  /**< Size of the entry in the circle cache */
     uint8_t * buf;
     lv_opa_t * cir_opa;         /**< Opacity of values on the circumference of an 1/4 circle */
     uint16_t * x_start_on_y;    /**< The x coordinate of the circle for each y value */
     uint16_t * opa_start_on_y;  /**< The index of `cir_opa` for each y value */
-    int32_t life;               /**< How many times the entry way used */
-    uint32_t used_cnt;          /**< Like a semaphore to count the referencing masks */
     int32_t radius;             /**< The radius of the entry */
+    bool cached;                /**< false: not in the cache, freed when the mask is freed */
 } lv_draw_sw_mask_radius_circle_dsc_t;
 
 struct lv_draw_sw_mask_common_dsc_t {
@@ -132,17 +133,24 @@ struct lv_draw_sw_mask_map_param_t {
     } cfg;
 };
 
-typedef lv_draw_sw_mask_radius_circle_dsc_t lv_draw_sw_mask_radius_circle_dsc_arr_t[LV_DRAW_SW_CIRCLE_CACHE_SIZE];
-
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
 /**
- * Called by LVGL the rendering of a screen is ready to clean up
- * the temporal (cache) data of the masks
+ * Get the coverage of a row of a (not inverted) radius mask as spans instead of an opacity buffer.
+ * The pixels between `x_left` and `x_right` are fully covered, the pixels left to
+ * `x_left - aa_len + 1` and right to `x_right + aa_len - 1` are transparent.
+ * @param param     an initialized radius mask
+ * @param abs_y     the row to check. Should be between `rect.y1` and `rect.y2` of the mask.
+ * @param x_left    store here the last anti-aliased pixel on the left side
+ * @param x_right   store here the first anti-aliased pixel on the right side
+ * @param aa_len    store here the number of anti-aliased pixels on each side
+ * @return          the opacity of the anti-aliased pixels: `x_left - i` and `x_right + i` has `[aa_len - 1 - i]`.
+ *                  NULL if the whole row of the rectangle is covered (`x_left` and `x_right` are still set).
  */
-void lv_draw_sw_mask_cleanup(void);
+const lv_opa_t * lv_draw_sw_mask_radius_get_row(const lv_draw_sw_mask_radius_param_t * param, int32_t abs_y,
+                                                int32_t * x_left, int32_t * x_right, int32_t * aa_len);
 
 /**********************
  *      MACROS
@@ -83,35 +83,50 @@ void lv_draw_sw_mask_rect(lv_draw_unit_t * draw_unit, const lv_draw_mask_rect_ds
     lv_draw_sw_mask_radius_param_t param;
     lv_draw_sw_mask_radius_init(&param, &dsc->area, dsc->radius, false);
 
-    void * masks[2] = {0};
-    masks[0] = &param;
-
-    uint32_t area_w = lv_area_get_width(&draw_area);
-    lv_opa_t * mask_buf = lv_malloc(area_w);
-
+    /*Only the corner rows need to be masked, the rest of the area is fully covered*/
+    int32_t radius = param.cfg.radius;
     int32_t y;
     for(y = draw_area.y1; y <= draw_area.y2; y++) {
-        lv_memset(mask_buf, 0xff, area_w);
-        lv_draw_sw_mask_res_t res = lv_draw_sw_mask_apply(masks, mask_buf, draw_area.x1, y, area_w);
-        if(res == LV_DRAW_SW_MASK_RES_FULL_COVER) continue;
+        if(y >= dsc->area.y1 + radius && y <= dsc->area.y2 - radius) {
+            y = dsc->area.y2 - radius;
+            continue;
+        }
+
+        int32_t x_left;
+        int32_t x_right;
+        int32_t aa_len;
+        const lv_opa_t * aa_opa = lv_draw_sw_mask_radius_get_row(&param, y, &x_left, &x_right, &aa_len);
+        if(aa_opa == NULL) continue;
 
         lv_color32_t * c32_buf = lv_draw_layer_go_to_xy(target_layer, draw_area.x1 - buf_area->x1,
                                                         y - buf_area->y1);
 
-        if(res == LV_DRAW_SW_MASK_RES_TRANSP) {
-            lv_memzero(c32_buf, area_w * sizeof(lv_color32_t));
-        }
-        else {
-            uint32_t i;
-            for(i = 0; i < area_w; i++) {
-                if(mask_buf[i] != LV_OPA_COVER) {
-                    c32_buf[i].alpha = LV_OPA_MIX2(c32_buf[i].alpha, mask_buf[i]);
-                }
+        /*Clear the outer parts*/
+        int32_t x;
+        int32_t x_end = LV_MIN(x_left - aa_len, draw_area.x2);
+        for(x = draw_area.x1; x <= x_end; x++) c32_buf[x - draw_area.x1].alpha = 0;
+
+        x = LV_MAX(x_right + aa_len, draw_area.x1);
+        for(; x <= draw_area.x2; x++) c32_buf[x - draw_area.x1].alpha = 0;
+
+        /*Fade the anti-aliased pixels*/
+        int32_t i;
+        for(i = 0; i < aa_len; i++) {
+            lv_opa_t opa = aa_opa[aa_len - 1 - i];
+            if(opa == LV_OPA_COVER) continue;
+
+            x = x_left - i;
+            if(x >= draw_area.x1 && x <= draw_area.x2) {
+                c32_buf[x - draw_area.x1].alpha = LV_OPA_MIX2(c32_buf[x - draw_area.x1].alpha, opa);
+            }
+
+            x = x_right + i;
+            if(x >= draw_area.x1 && x <= draw_area.x2) {
+                c32_buf[x - draw_area.x1].alpha = LV_OPA_MIX2(c32_buf[x - draw_area.x1].alpha, opa);
             }
         }
     }
 
-    lv_free(mask_buf);
     lv_draw_sw_mask_free_param(&param);
 }
 
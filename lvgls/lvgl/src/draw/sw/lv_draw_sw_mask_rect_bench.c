@@ -0,0 +1,147 @@
+/**
+ * @file lv_draw_sw_mask_rect_bench.c
+ *
+ * Benchmark of the rounded rectangle mask with scrolled lists clipped to their rounded corners.
+ * It's a standalone program which is compiled only if `LV_DRAW_SW_MASK_RECT_BENCH` is defined.
+ *
+ * Build it on a host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_DRAW_SW_MASK_RECT_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o mask_rect_bench
+ *
+ * Usage: `./mask_rect_bench [frame_cnt]`
+ *
+ * Three lists with `clip_corner` and different radii are scrolled in every frame,
+ * so most of the screen is redrawn through a rectangle mask.
+ * The time of a frame and a hash of the flushed pixels are printed.
+ * The hash should be the same with any implementation of the mask.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_DRAW_SW_MASK_RECT_BENCH
+
+#include "../../../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         800
+#define VER_RES         480
+#define LIST_CNT        3
+#define ITEM_CNT        30
+#define POOL_CNT        ((512 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint8_t draw_buf[HOR_RES * 40 * 2];
+static uint32_t tick;
+static uint32_t hash;
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frame_cnt = argc > 1 ? atoi(argv[1]) : 200;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_t * lists[LIST_CNT];
+    static const int32_t radii[LIST_CNT] = {10, 24, 40};
+    uint32_t l;
+    for(l = 0; l < LIST_CNT; l++) {
+        lv_obj_t * list = lv_list_create(scr);
+        lv_obj_set_size(list, 240, 420);
+        lv_obj_set_pos(list, 15 + l * 260, 30);
+        lv_obj_set_style_radius(list, radii[l], 0);
+        lv_obj_set_style_clip_corner(list, true, 0);
+        for(i = 0; i < ITEM_CNT; i++) {
+            char text[32];
+            lv_snprintf(text, sizeof(text), "Item %"LV_PRIu32, i);
+            lv_obj_t * btn = lv_list_add_button(list, LV_SYMBOL_FILE, text);
+            lv_obj_set_style_bg_color(btn, lv_palette_main(i % LV_PALETTE_LAST), 0);
+        }
+        lists[l] = list;
+    }
+
+    /*Draw the first frame to create everything*/
+    lv_refr_now(disp);
+
+    /*FNV-1a*/
+    hash = 2166136261u;
+    double t_start = now_ms();
+    for(i = 0; i < frame_cnt; i++) {
+        for(l = 0; l < LIST_CNT; l++) {
+            lv_obj_scroll_to_y(lists[l], (i * (3 + l)) % 900, LV_ANIM_OFF);
+        }
+        tick += 33;
+        lv_refr_now(disp);
+    }
+    double t_frames = now_ms() - t_start;
+
+    printf("rounded lists: %.3f ms/frame, hash: %08"LV_PRIx32"\n", t_frames / frame_cnt, hash);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    uint32_t size = lv_area_get_size(area) * 2;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        hash = (hash ^ px_map[i]) * 16777619u;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return tick;
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_DRAW_SW_MASK_RECT_BENCH*/
@@ -23,6 +23,10 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** 1: large draw tasks are split into bands rendered by the idle draw units*/
+#define LV_DRAW_SW_USE_BAND_SPLIT   (LV_DRAW_SW_BAND_SPLIT_MIN_AREA > 0 && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && \
+                                     LV_USE_OS && !LV_USE_PARALLEL_DRAW_DEBUG)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -43,18 +47,36 @@ struct lv_draw_sw_unit_t {
     uint32_t idx;
 };
 
-#if LV_DRAW_SW_SHADOW_CACHE_SIZE
+#if LV_DRAW_SW_USE_BAND_SPLIT
+/** A draw task being rendered in horizontal bands by multiple draw units*/
 typedef struct {
-    uint8_t cache[LV_DRAW_SW_SHADOW_CACHE_SIZE * LV_DRAW_SW_SHADOW_CACHE_SIZE];
-    int32_t cache_size;
-    int32_t cache_r;
-} lv_draw_sw_shadow_cache_t;
+    lv_mutex_t lock;
+    lv_draw_task_t * task;          /**< The task being split. NULL if there is no job*/
+    lv_draw_sw_unit_t * owner;      /**< The draw unit which has received the task*/
+    lv_area_t area;                 /**< The area to render in bands*/
+    int32_t band_h;
+    uint32_t band_cnt;
+    uint32_t band_next;             /**< Index of the next band to take*/
+    uint32_t band_done;             /**< Number of the rendered bands*/
+} lv_draw_sw_band_job_t;
 #endif
 
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_DRAW_SW_COMPLEX && LV_DRAW_SW_SHADOW_CACHE_SIZE
+/**
+ * Create the cache of the blurred shadow corners
+ */
+void lv_draw_sw_shadow_cache_init(void);
+
+/**
+ * Delete the cache of the blurred shadow corners
+ */
+void lv_draw_sw_shadow_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
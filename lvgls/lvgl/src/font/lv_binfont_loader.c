@@ -9,9 +9,11 @@
 #include "lv_font_fmt_txt_private.h"
 #include "../lvgl.h"
 #include "../misc/lv_fs_private.h"
+#include "../misc/lv_text_private.h"
 #include "../misc/lv_types.h"
 #include "../stdlib/lv_string.h"
 #include "lv_binfont_loader.h"
+#include "lv_font_glyph_cache.h"
 
 /**********************
  *      TYPEDEFS
@@ -121,6 +123,14 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    lv_font_fmt_txt_cache_invalidate(dsc);
+#endif
+
+    /*The glyphs and text layouts are cached by the font's address which might be reused by a new font*/
+    lv_font_glyph_cache_drop();
+    lv_text_layout_cache_drop();
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
@@ -22,6 +22,13 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    #define gid_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_gid_cache
+    #define kern_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_kern_cache
+    /*Spread the entries of the fonts differently*/
+    #define FDSC_HASH(fdsc) ((uint32_t)((lv_uintptr_t)(fdsc) >> 4))
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,7 +41,9 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
+static int8_t find_kern_pair_value(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
@@ -210,6 +219,17 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+void lv_font_fmt_txt_cache_invalidate(const lv_font_fmt_txt_dsc_t * fdsc)
+{
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_CACHE_SIZE; i++) {
+        if(gid_cache[i].fdsc == fdsc) gid_cache[i].fdsc = NULL;
+        if(kern_cache[i].fdsc == fdsc) kern_cache[i].fdsc = NULL;
+    }
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -218,8 +238,30 @@ static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
 {
     if(letter == '\0') return 0;
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    const lv_font_fmt_txt_dsc_t * fdsc = (const lv_font_fmt_txt_dsc_t *)font->dsc;
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+    lv_font_fmt_txt_gid_cache_entry_t * entry = &gid_cache[(letter ^ FDSC_HASH(fdsc)) & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)];
+    if(entry->fdsc == fdsc && entry->letter == letter) return entry->gid;
+
+    uint32_t gid = find_glyph_dsc_id(fdsc, letter);
+    entry->fdsc = fdsc;
+    entry->letter = letter;
+    entry->gid = gid;
+    return gid;
+#else
+    return find_glyph_dsc_id(fdsc, letter);
+#endif
+}
+
+/**
+ * Search a letter in the character maps of a font
+ * @param fdsc      pointer to the font descriptor
+ * @param letter    a Unicode code point
+ * @return          the glyph ID or 0 if the letter is not in the font
+ */
+static uint32_t find_glyph_dsc_id(const lv_font_fmt_txt_dsc_t * fdsc, uint32_t letter)
+{
     uint16_t i;
     for(i = 0; i < fdsc->cmap_num; i++) {
 
@@ -272,36 +314,22 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     if(fdsc->kern_classes == 0) {
         /*Kern pairs*/
         const lv_font_fmt_txt_kern_pair_t * kdsc = fdsc->kern_dsc;
-        if(kdsc->glyph_ids_size == 0) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint16_t * g_ids = kdsc->glyph_ids;
-            kern_pair_ref_t g_id_both = {gid_left, gid_right};
-            uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
+#if LV_FONT_FMT_TXT_USE_CACHE
+        /*Searching the pairs is slow so cache the result. Kern classes are looked up directly*/
+        uint32_t idx = (gid_left * 31 + gid_right) ^ FDSC_HASH(fdsc);
+        lv_font_fmt_txt_kern_cache_entry_t * entry = &kern_cache[idx & (LV_FONT_FMT_TXT_CACHE_SIZE - 1)];
+        if(entry->fdsc == fdsc && entry->gid_left == gid_left && entry->gid_right == gid_right) {
+            return entry->value;
         }
-        else if(kdsc->glyph_ids_size == 1) {
-            /*Use binary search to find the kern value.
-             *The pairs are ordered left_id first, then right_id secondly.*/
-            const uint32_t * g_ids = kdsc->glyph_ids;
-            kern_pair_ref_t g_id_both = {gid_left, gid_right};
-            uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
-
-            /*If the `g_id_both` were found get its index from the pointer*/
-            if(kid_p) {
-                lv_uintptr_t ofs = kid_p - g_ids;
-                value = kdsc->values[ofs];
-            }
 
-        }
-        else {
-            /*Invalid value*/
-        }
+        value = find_kern_pair_value(kdsc, gid_left, gid_right);
+        entry->fdsc = fdsc;
+        entry->gid_left = gid_left;
+        entry->gid_right = gid_right;
+        entry->value = value;
+#else
+        value = find_kern_pair_value(kdsc, gid_left, gid_right);
+#endif
     }
     else {
         /*Kern classes*/
@@ -319,6 +347,51 @@ static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t
     return value;
 }
 
+/**
+ * Search a glyph pair in the kerning pairs of a font
+ * @param kdsc          pointer to the kerning pairs
+ * @param gid_left      glyph ID of the left glyph
+ * @param gid_right     glyph ID of the right glyph
+ * @return              the kerning value or 0 if the pair is not found
+ */
+static int8_t find_kern_pair_value(const lv_font_fmt_txt_kern_pair_t * kdsc, uint32_t gid_left, uint32_t gid_right)
+{
+    int8_t value = 0;
+
+    if(kdsc->glyph_ids_size == 0) {
+        /*Use binary search to find the kern value.
+         *The pairs are ordered left_id first, then right_id secondly.*/
+        const uint16_t * g_ids = kdsc->glyph_ids;
+        kern_pair_ref_t g_id_both = {gid_left, gid_right};
+        uint16_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 2, kern_pair_8_compare);
+
+        /*If the `g_id_both` were found get its index from the pointer*/
+        if(kid_p) {
+            lv_uintptr_t ofs = kid_p - g_ids;
+            value = kdsc->values[ofs];
+        }
+    }
+    else if(kdsc->glyph_ids_size == 1) {
+        /*Use binary search to find the kern value.
+         *The pairs are ordered left_id first, then right_id secondly.*/
+        const uint32_t * g_ids = kdsc->glyph_ids;
+        kern_pair_ref_t g_id_both = {gid_left, gid_right};
+        uint32_t * kid_p = lv_utils_bsearch(&g_id_both, g_ids, kdsc->pair_cnt, 4, kern_pair_16_compare);
+
+        /*If the `g_id_both` were found get its index from the pointer*/
+        if(kid_p) {
+            lv_uintptr_t ofs = kid_p - g_ids;
+            value = kdsc->values[ofs];
+        }
+
+    }
+    else {
+        /*Invalid value*/
+    }
+
+    return value;
+}
+
 static int kern_pair_8_compare(const void * ref, const void * element)
 {
     const kern_pair_ref_t * ref8_p = ref;
@@ -0,0 +1,195 @@
+/**
+ * @file lv_font_fmt_txt_bench.c
+ *
+ * Benchmark of the glyph lookups in the built-in font format with text-heavy screens.
+ * It's a standalone program which is compiled only if `LV_FONT_FMT_TXT_BENCH` is defined.
+ *
+ * Build it on a host. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_FONT_FMT_TXT_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o font_bench
+ *
+ * Usage: `./font_bench [frame_cnt]`
+ *
+ * First the glyph descriptors of a paragraph are looked up many times with `lv_font_get_glyph_dsc()`
+ * and the number of lookups per second is printed. It's done with Montserrat 14 and,
+ * if `LV_FONT_SIMSUN_16_CJK` is enabled, with a Chinese text too.
+ * After that a screen of labels with the same texts is redrawn and the time of a frame
+ * and a hash of the flushed pixels are printed.
+ * Build it with `LV_FONT_FMT_TXT_CACHE_SIZE 0` to compare the speed. The hashes should be the same.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_FONT_FMT_TXT_BENCH
+
+#include "../../lvgl.h"
+#include "../lvgl_private.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         800
+#define VER_RES         480
+#define LETTER_MAX      512
+#define LOOKUP_CNT      2000000
+#define POOL_CNT        ((512 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lookup_bench(const char * name, const lv_font_t * font, const char * text);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint8_t draw_buf[HOR_RES * 40 * 2];
+static uint32_t tick;
+static uint32_t hash;
+
+static const char * text_latin =
+    "The quick brown fox jumps over the lazy dog. Typography, kerning and glyph metrics "
+    "(AV, To, Wa, Yo) are looked up for every letter of every label on each redraw: 0123456789!";
+
+#if LV_FONT_SIMSUN_16_CJK
+static const char * text_cjk =
+    "我们的国家有很多人，他们在这里工作和学习。今天天气很好，大家一起出去看山水。"
+    "中文字体的字形很多，每一个字都要在字体中找到它的位置。";
+#endif
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t frame_cnt = argc > 1 ? atoi(argv[1]) : 100;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+    printf("glyph cache size: %d\n", LV_FONT_FMT_TXT_CACHE_SIZE);
+
+    lookup_bench("montserrat_14", &lv_font_montserrat_14, text_latin);
+#if LV_FONT_SIMSUN_16_CJK
+    lookup_bench("simsun_16_cjk", &lv_font_simsun_16_cjk, text_cjk);
+#endif
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
+    for(i = 0; i < 8; i++) {
+        lv_obj_t * label = lv_label_create(scr);
+        lv_obj_set_width(label, lv_pct(100));
+#if LV_FONT_SIMSUN_16_CJK
+        if(i % 2) {
+            lv_obj_set_style_text_font(label, &lv_font_simsun_16_cjk, 0);
+            lv_label_set_text_static(label, text_cjk);
+            continue;
+        }
+#endif
+        lv_label_set_text_static(label, text_latin);
+    }
+
+    /*Draw the first frame to create everything*/
+    lv_refr_now(disp);
+
+    /*FNV-1a*/
+    hash = 2166136261u;
+    double t_start = now_ms();
+    for(i = 0; i < frame_cnt; i++) {
+        lv_obj_invalidate(scr);
+        tick += 33;
+        lv_refr_now(disp);
+    }
+    double t_frames = now_ms() - t_start;
+
+    printf("labels: %.3f ms/frame, hash: %08"LV_PRIx32"\n", t_frames / frame_cnt, hash);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Look up the glyph descriptors of the letters of a text `LOOKUP_CNT` times and print the speed
+ * @param name      name of the font to print
+ * @param font      the font to use
+ * @param text      an UTF-8 text
+ */
+static void lookup_bench(const char * name, const lv_font_t * font, const char * text)
+{
+    static uint32_t letters[LETTER_MAX + 1];
+    uint32_t letter_cnt = 0;
+    uint32_t ofs = 0;
+    while(text[ofs] != '\0' && letter_cnt < LETTER_MAX) {
+        letters[letter_cnt] = lv_text_encoded_next(text, &ofs);
+        letter_cnt++;
+    }
+    letters[letter_cnt] = '\0';
+
+    lv_font_glyph_dsc_t dsc;
+    uint32_t found_cnt = 0;
+    uint32_t i = 0;
+    uint32_t n;
+    double t_start = now_ms();
+    for(n = 0; n < LOOKUP_CNT; n++) {
+        if(lv_font_get_glyph_dsc(font, &dsc, letters[i], letters[i + 1])) found_cnt++;
+        i++;
+        if(i == letter_cnt) i = 0;
+    }
+    double t_lookup = now_ms() - t_start;
+
+    printf("%s: %.2f M glyph lookups/s, found: %"LV_PRIu32"/%d\n", name,
+           LOOKUP_CNT / t_lookup / 1e3, found_cnt, LOOKUP_CNT);
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    uint32_t size = lv_area_get_size(area) * 2;
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        hash = (hash ^ px_map[i]) * 16777619u;
+    }
+
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return tick;
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_FONT_FMT_TXT_BENCH*/
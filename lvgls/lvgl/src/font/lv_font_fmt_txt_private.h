@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/*The glyph ID and kerning caches are shared by all fonts without locking*/
+#define LV_FONT_FMT_TXT_USE_CACHE (LV_FONT_FMT_TXT_CACHE_SIZE > 0 && LV_USE_OS == LV_OS_NONE)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -41,10 +44,34 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< NULL if the entry is unused*/
+    uint32_t letter;
+    uint32_t gid;                           /**< 0 if the letter is not in the font*/
+} lv_font_fmt_txt_gid_cache_entry_t;
+
+typedef struct {
+    const lv_font_fmt_txt_dsc_t * fdsc;     /**< NULL if the entry is unused*/
+    uint32_t gid_left;
+    uint32_t gid_right;
+    int8_t value;
+} lv_font_fmt_txt_kern_cache_entry_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_FONT_FMT_TXT_USE_CACHE
+/**
+ * Remove the cached glyph IDs and kerning values of a font.
+ * Needs to be called before freeing a dynamically created font descriptor.
+ * @param fdsc  pointer to the font descriptor
+ */
+void lv_font_fmt_txt_cache_invalidate(const lv_font_fmt_txt_dsc_t * fdsc);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,191 @@
+/**
+ * @file lv_font_glyph_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_font_glyph_cache.h"
+#include "lv_font_fmt_txt.h"
+#include "../misc/lv_assert.h"
+#include "../core/lv_global.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CACHE_NAME  "FONT_GLYPH"
+
+#define glyph_cache_p (LV_GLOBAL_DEFAULT()->font_glyph_cache)
+#define glyph_cache_hit (LV_GLOBAL_DEFAULT()->font_glyph_cache_hit)
+#define glyph_cache_miss (LV_GLOBAL_DEFAULT()->font_glyph_cache_miss)
+#define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef struct {
+    lv_cache_slot_size_t slot;
+
+    const lv_font_t * font;
+    uint32_t gid;
+    lv_font_glyph_format_t format;  /*Stands for the bpp of the glyph*/
+
+    lv_draw_buf_t * draw_buf;
+} glyph_cache_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_font_glyph_cache_init(uint32_t size)
+{
+    if(glyph_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    glyph_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(glyph_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t) glyph_cache_free_cb
+    });
+
+    if(glyph_cache_p == NULL) return LV_RESULT_INVALID;
+
+    lv_cache_set_name(glyph_cache_p, CACHE_NAME);
+    return LV_RESULT_OK;
+}
+
+void lv_font_glyph_cache_deinit(void)
+{
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_destroy(glyph_cache_p, NULL);
+    glyph_cache_p = NULL;
+}
+
+void lv_font_glyph_cache_resize(uint32_t new_size, bool evict_now)
+{
+    lv_cache_set_max_size(glyph_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(glyph_cache_p, new_size, NULL);
+    }
+}
+
+void lv_font_glyph_cache_drop(void)
+{
+    if(glyph_cache_p == NULL) return;
+
+    lv_cache_drop_all(glyph_cache_p, NULL);
+}
+
+bool lv_font_glyph_cache_is_enabled(void)
+{
+    return glyph_cache_p != NULL && lv_cache_is_enabled(glyph_cache_p);
+}
+
+const lv_draw_buf_t * lv_font_glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_ASSERT_NULL(g_dsc);
+
+    const lv_font_t * font = g_dsc->resolved_font;
+    if(font == NULL || font->get_glyph_bitmap != lv_font_get_bitmap_fmt_txt) return NULL;
+    if(g_dsc->format <= LV_FONT_GLYPH_FORMAT_NONE || g_dsc->format >= LV_FONT_GLYPH_FORMAT_IMAGE) return NULL;
+    if(!lv_font_glyph_cache_is_enabled()) return NULL;
+
+    /*The buffer's header is counted too as it's not negligible for small glyphs*/
+    uint32_t stride = lv_draw_buf_width_to_stride(g_dsc->box_w, LV_COLOR_FORMAT_A8);
+    glyph_cache_data_t search_key = {
+        .slot.size = stride * g_dsc->box_h + sizeof(lv_draw_buf_t),
+        .font = font,
+        .gid = g_dsc->gid.index,
+        .format = g_dsc->format,
+    };
+
+    uint32_t miss_prev = glyph_cache_miss;
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache_p, &search_key, g_dsc);
+    if(entry == NULL) return NULL;
+
+    /*`glyph_cache_create_cb` counts the misses*/
+    if(miss_prev == glyph_cache_miss) glyph_cache_hit++;
+
+    g_dsc->entry = entry;
+    glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+void lv_font_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_ASSERT_NULL(g_dsc);
+
+    if(g_dsc->entry == NULL) return;
+
+    lv_cache_release(glyph_cache_p, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+void lv_font_glyph_cache_get_stat(uint32_t * hit, uint32_t * miss)
+{
+    if(hit) *hit = glyph_cache_hit;
+    if(miss) *miss = glyph_cache_miss;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    lv_font_glyph_dsc_t * g_dsc = user_data;
+
+    glyph_cache_miss++;
+
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, g_dsc->box_w, g_dsc->box_h,
+                                                     LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(draw_buf == NULL) return false;
+
+    if(lv_font_get_glyph_bitmap(g_dsc, draw_buf) == NULL) {
+        lv_draw_buf_destroy(draw_buf);
+        return false;
+    }
+
+    data->draw_buf = draw_buf;
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_draw_buf_destroy(data->draw_buf);
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->font != rhs->font) {
+        return lhs->font > rhs->font ? 1 : -1;
+    }
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+    if(lhs->format != rhs->format) {
+        return lhs->format > rhs->format ? 1 : -1;
+    }
+    return 0;
+}
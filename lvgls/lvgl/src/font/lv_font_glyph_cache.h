@@ -0,0 +1,96 @@
+/**
+ * @file lv_font_glyph_cache.h
+ *
+ */
+
+#ifndef LV_FONT_GLYPH_CACHE_H
+#define LV_FONT_GLYPH_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+#include "lv_font.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the cache of rendered glyph bitmaps.
+ * @param size      size of the cache in bytes.
+ * @return          LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_font_glyph_cache_init(uint32_t size);
+
+/**
+ * Deinitialize the cache of rendered glyph bitmaps and free all the cached glyphs.
+ */
+void lv_font_glyph_cache_deinit(void);
+
+/**
+ * Resize the glyph cache.
+ * If set to 0, the cache will be disabled.
+ * @param new_size  new size of the cache in bytes.
+ * @param evict_now true: evict the glyphs should be removed by the eviction policy, false: wait for the next cache cleanup.
+ */
+void lv_font_glyph_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Drop all glyphs from the cache.
+ * Needs to be called before a font whose glyphs might be cached is deleted.
+ */
+void lv_font_glyph_cache_drop(void);
+
+/**
+ * Return true if the glyph cache is enabled.
+ * @return          true: enabled, false: disabled.
+ */
+bool lv_font_glyph_cache_is_enabled(void);
+
+/**
+ * Get the A8 bitmap of a glyph from the cache and render it if it's not cached yet.
+ * Only the fonts using `lv_font_get_bitmap_fmt_txt` are cached.
+ * The returned buffer must be released with `lv_font_glyph_cache_release()` after use.
+ * @param g_dsc     the glyph descriptor returned by `lv_font_get_glyph_dsc()`.
+ *                  `g_dsc->entry` will be set to the acquired cache entry.
+ * @return          the draw buffer with the glyph's bitmap or NULL if the glyph can't be cached
+ */
+const lv_draw_buf_t * lv_font_glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Release a glyph acquired by `lv_font_glyph_cache_acquire()`.
+ * @param g_dsc     the glyph descriptor passed to `lv_font_glyph_cache_acquire()`
+ */
+void lv_font_glyph_cache_release(lv_font_glyph_dsc_t * g_dsc);
+
+/**
+ * Get the number of glyph cache hits and misses since `lv_init()`.
+ * The counters are not synchronized between draw threads, so they are only approximate with parallel rendering.
+ * @param hit       store the number of hits here (can be NULL)
+ * @param miss      store the number of misses here (can be NULL)
+ */
+void lv_font_glyph_cache_get_stat(uint32_t * hit, uint32_t * miss);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FONT_GLYPH_CACHE_H*/
@@ -15,6 +15,7 @@
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_hit_index_private.h"
 #include "../core/lv_group.h"
 #include "../core/lv_refr.h"
 
@@ -579,6 +580,15 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
         int32_t i;
         uint32_t child_cnt = lv_obj_get_child_count(obj);
 
+#if LV_OBJ_HIT_INDEX_MIN_CHILD
+        /*Check only the children around the point*/
+        if(child_cnt >= LV_OBJ_HIT_INDEX_MIN_CHILD) {
+            found_p = lv_obj_hit_index_search_children(obj, &p_trans);
+            if(found_p) return found_p;
+            child_cnt = 0;
+        }
+#endif
+
         /*If a child matches use it*/
         for(i = child_cnt - 1; i >= 0; i--) {
             lv_obj_t * child = obj->spec_attr->children[i];
@@ -642,6 +652,10 @@ uint32_t lv_indev_remove_event_cb_with_user_data(lv_indev_t * indev, lv_event_cb
 lv_result_t lv_indev_send_event(lv_indev_t * indev, lv_event_code_t code, void * param)
 {
 
+#if LV_USE_PROFILER
+    lv_event_count_sent(code);
+#endif
+
     lv_event_t e;
     lv_memzero(&e, sizeof(e));
     e.code = code;
@@ -9,6 +9,7 @@
 #include "lv_flex.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_hit_index_private.h"
 
 #if LV_USE_FLEX
 
@@ -397,6 +398,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             }
 
             if(s != area_get_main_size(&item->coords)) {
+                lv_obj_hit_index_invalidate();
                 lv_obj_invalidate(item);
 
                 lv_area_t old_coords;
@@ -445,6 +447,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
         diff_y += f->row ? cross_pos : main_pos + get_margin_main_start(item, LV_PART_MAIN);
 
         if(diff_x || diff_y) {
+            lv_obj_hit_index_invalidate();
             lv_obj_invalidate(item);
             item->coords.x1 += diff_x;
             item->coords.x2 += diff_x;
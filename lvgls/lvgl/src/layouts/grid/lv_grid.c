@@ -13,6 +13,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../lv_layout.h"
 #include "../../core/lv_obj_private.h"
+#include "../../core/lv_obj_hit_index_private.h"
 #include "../../core/lv_global.h"
 /*********************
  *      DEFINES
@@ -538,6 +539,7 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
 
     /*Set a new size if required*/
     if(lv_obj_get_width(item) != item_w || lv_obj_get_height(item) != item_h) {
+        lv_obj_hit_index_invalidate();
         lv_area_t old_coords;
         lv_area_copy(&old_coords, &item->coords);
         lv_obj_invalidate(item);
@@ -563,6 +565,7 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     int32_t diff_x = hint->grid_abs.x + x - item->coords.x1;
     int32_t diff_y = hint->grid_abs.y + y - item->coords.y1;
     if(diff_x || diff_y) {
+        lv_obj_hit_index_invalidate();
         lv_obj_invalidate(item);
         item->coords.x1 += diff_x;
         item->coords.x2 += diff_x;
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "../../misc/lv_fs_private.h"
+#include "../../misc/lv_text_private.h"
 #include "lv_freetype_private.h"
 
 #if LV_USE_FREETYPE
@@ -184,6 +185,9 @@ void lv_freetype_font_delete(lv_font_t * font)
     lv_freetype_font_dsc_t * dsc = (lv_freetype_font_dsc_t *)(font->dsc);
     LV_ASSERT_FREETYPE_FONT_DSC(dsc);
 
+    /*The text layouts are cached by the font's address which might be reused by a new font*/
+    lv_text_layout_cache_drop();
+
     lv_cache_release(ctx->cache_node_cache, dsc->cache_node_entry, NULL);
     if(lv_cache_entry_get_ref(dsc->cache_node_entry) == 0) {
         lv_cache_drop(ctx->cache_node_cache, dsc->cache_node, NULL);
@@ -10,6 +10,7 @@
 
 #if LV_USE_TINY_TTF != 0
 #include "../../core/lv_global.h"
+#include "../../misc/lv_text_private.h"
 
 #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
 
@@ -135,6 +136,9 @@ void lv_tiny_ttf_set_size(lv_font_t * font, int32_t font_size)
 
     /* size change means cache needs to be invalidated. */
 
+    /*The text layouts are cached by the font's address so they would keep the old sizes*/
+    lv_text_layout_cache_drop();
+
     if(dsc->glyph_cache) {
         lv_cache_destroy(dsc->glyph_cache, NULL);
         dsc->glyph_cache = NULL;
@@ -152,6 +156,9 @@ void lv_tiny_ttf_destroy(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
 
+    /*The text layouts are cached by the font's address which might be reused by a new font*/
+    lv_text_layout_cache_drop();
+
     if(font->dsc != NULL) {
         ttf_font_desc_t * ttf = (ttf_font_desc_t *)font->dsc;
 #if LV_TINY_TTF_FILE_SUPPORT != 0
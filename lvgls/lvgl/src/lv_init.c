@@ -33,8 +33,10 @@
 #include "libs/libpng/lv_libpng.h"
 #include "libs/tiny_ttf/lv_tiny_ttf.h"
 #include "draw/lv_draw.h"
+#include "font/lv_font_glyph_cache.h"
 #include "misc/lv_async.h"
 #include "misc/lv_fs_private.h"
+#include "misc/lv_text_private.h"
 #include "widgets/span/lv_span.h"
 #include "themes/simple/lv_theme_simple.h"
 #include "misc/lv_fs.h"
@@ -118,11 +120,6 @@ static inline void lv_global_init(lv_global_t * global)
     void LV_LOG_PRINT_CB(lv_log_level_t, const char * txt);
     global->custom_log_print_cb = LV_LOG_PRINT_CB;
 #endif
-
-#if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
-    global->sw_shadow_cache.cache_size = -1;
-    global->sw_shadow_cache.cache_r = -1;
-#endif
 }
 
 static inline void lv_cleanup_devices(lv_global_t * global)
@@ -230,6 +227,9 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+    lv_font_glyph_cache_init(LV_FONT_GLYPH_CACHE_SIZE);
+    lv_text_layout_cache_init(LV_TEXT_LAYOUT_CACHE_SIZE);
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -383,8 +383,15 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_IMAGE_PREFETCH
+    lv_image_prefetch_deinit();
+#endif
+
     lv_image_decoder_deinit();
 
+    lv_font_glyph_cache_deinit();
+    lv_text_layout_cache_deinit();
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
@@ -427,6 +434,8 @@ void lv_deinit(void)
     lv_objid_builtin_destroy();
 #endif
 
+    lv_draw_buf_deinit_handlers();
+
     lv_mem_deinit();
 
     lv_initialized = false;
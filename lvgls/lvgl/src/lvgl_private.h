@@ -36,6 +36,7 @@ extern "C" {
 #include "draw/lv_draw_rect_private.h"
 #include "draw/lv_draw_image_private.h"
 #include "draw/lv_image_decoder_private.h"
+#include "draw/lv_image_prefetch_private.h"
 #include "draw/lv_draw_label_private.h"
 #include "draw/lv_draw_vector_private.h"
 #include "draw/lv_draw_buf_private.h"
@@ -56,6 +57,7 @@ extern "C" {
 #include "core/lv_obj_class_private.h"
 #include "core/lv_group_private.h"
 #include "core/lv_obj_event_private.h"
+#include "core/lv_obj_hit_index_private.h"
 #include "misc/lv_timer_private.h"
 #include "misc/lv_area_private.h"
 #include "misc/lv_fs_private.h"
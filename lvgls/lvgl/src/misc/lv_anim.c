@@ -23,10 +23,21 @@
 #define LV_ANIM_RES_SHIFT 10
 #define state LV_GLOBAL_DEFAULT()->anim_state
 #define anim_ll_p &(state.anim_ll)
+#define HASH_SIZE_MIN 16
 
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_ANIM_BATCH_STEP
+/** The paths which can be calculated in a batch*/
+typedef enum {
+    ANIM_PATH_CUSTOM,
+    ANIM_PATH_LINEAR,
+    ANIM_PATH_EASE_IN,
+    ANIM_PATH_EASE_OUT,
+    ANIM_PATH_EASE_IN_OUT,
+} anim_path_type_t;
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
@@ -40,10 +51,31 @@ static uint32_t convert_speed_to_time(uint32_t speed, int32_t start, int32_t end
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
 static void remove_anim(void * a);
+static void anim_unlink(lv_anim_t * a);
+static bool anim_step_begin(lv_anim_t * a);
+static void anim_apply(lv_anim_t * a, int32_t new_value);
+static lv_anim_t ** hash_get_bucket(const void * var);
+static lv_anim_t * hash_find(const void * var, lv_anim_exec_xcb_t exec_cb);
+static bool hash_reserve(uint32_t cnt);
+static void hash_insert(lv_anim_t * a);
+static void hash_remove(lv_anim_t * a);
+#if LV_ANIM_BATCH_STEP
+    static bool batch_reserve(uint32_t cnt);
+    static void batch_step(void);
+    static void batch_calc_values(lv_anim_batch_t * batch);
+    static anim_path_type_t get_path_type(lv_anim_path_cb_t path_cb);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_ANIM_BATCH_STEP
+static const lv_anim_bezier3_para_t batch_bezier_paras[] = {
+    [ANIM_PATH_EASE_IN] = {LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(1), LV_BEZIER_VAL_FLOAT(1)},
+    [ANIM_PATH_EASE_OUT] = {LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+    [ANIM_PATH_EASE_IN_OUT] = {LV_BEZIER_VAL_FLOAT(0.42), LV_BEZIER_VAL_FLOAT(0), LV_BEZIER_VAL_FLOAT(0.58), LV_BEZIER_VAL_FLOAT(1)},
+};
+#endif
 
 /**********************
  *      MACROS
@@ -70,6 +102,15 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.hash_table);
+    state.hash_table = NULL;
+    state.hash_size = 0;
+
+#if LV_ANIM_BATCH_STEP
+    lv_free(state.batch.anims);
+    lv_memzero(&state.batch, sizeof(state.batch));
+#endif
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -87,6 +128,11 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
+    if(!hash_reserve(state.anim_cnt + 1)) {
+        LV_LOG_WARN("Couldn't allocate the hash table of the animations");
+        return NULL;
+    }
+
     /*Add the new animation to the animation linked list*/
     lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
     LV_ASSERT_MALLOC(new_anim);
@@ -95,6 +141,8 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
     /*Initialize the animation descriptor*/
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
+    hash_insert(new_anim);
+    state.anim_cnt++;
     new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
 
@@ -146,6 +194,20 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
     lv_anim_t * a;
     bool del_any = false;
+
+    if(var != NULL) {
+        /*Always search again on delete, because we don't know
+         *how the animations were changed in `a->deleted_cb` */
+        while((a = hash_find(var, exec_cb)) != NULL) {
+            remove_anim(a);
+            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
+                                       the linked list*/
+            del_any = true;
+        }
+
+        return del_any;
+    }
+
     a        = lv_ll_get_head(anim_ll_p);
     while(a != NULL) {
         bool del = false;
@@ -173,14 +235,7 @@ void lv_anim_delete_all(void)
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
-        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
-            return a;
-        }
-    }
-
-    return NULL;
+    return hash_find(var, exec_cb);
 }
 
 lv_timer_t * lv_anim_get_timer(void)
@@ -190,11 +245,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)state.anim_cnt;
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -497,69 +548,96 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
+#if LV_ANIM_BATCH_STEP
+    /*If called recursively from an exec callback step the animations one by one*/
+    if(!state.batch.active && batch_reserve(state.anim_cnt)) {
+        batch_step();
+        return;
+    }
+#endif
+
+    /*New animations are added to the head, so they are not stepped in this round.
+     *If the next animation is deleted meanwhile `anim_unlink` updates the iterator.*/
+    lv_anim_iter_t iter;
+    iter.next = lv_ll_get_head(anim_ll_p);
+    iter.parent = state.iter;
+    state.iter = &iter;
 
-    while(a != NULL) {
-        uint32_t elaps = lv_tick_elaps(a->last_timer_run);
-        a->act_time += elaps;
+    while(iter.next != NULL) {
+        lv_anim_t * a = iter.next;
+        iter.next = lv_ll_get_next(anim_ll_p, a);
 
-        a->last_timer_run = lv_tick_get();
+        if(anim_step_begin(a)) {
+            anim_apply(a, a->path_cb(a));
+        }
+    }
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
-         */
-        state.anim_list_changed = false;
+    state.iter = iter.parent;
+}
+
+/**
+ * Update the time of an animation and start it if its delay is elapsed.
+ * @param a     pointer to an animation descriptor
+ * @return      true: the new value of the animation needs to be applied
+ */
+static bool anim_step_begin(lv_anim_t * a)
+{
+    uint32_t elaps = lv_tick_elaps(a->last_timer_run);
+    a->act_time += elaps;
 
-        if(a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+    a->last_timer_run = lv_tick_get();
 
-            /*The animation will run now for the first time. Call `start_cb`*/
-            if(!a->start_cb_called && a->act_time >= 0) {
+    /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
+     * happened in `anim_completed_handler` which could delete this animation too.
+     */
+    state.anim_list_changed = false;
 
-                if(a->early_apply == 0 && a->get_value_cb) {
-                    int32_t v_ofs = a->get_value_cb(a);
-                    a->start_value += v_ofs;
-                    a->end_value += v_ofs;
-                }
+    /*`anim_timer` might be called recursively so need to know which anim has run already*/
+    if(a->run_round == state.anim_run_round) return false;
+    a->run_round = state.anim_run_round;
 
-                resolve_time(a);
+    /*The animation will run now for the first time. Call `start_cb`*/
+    if(!a->start_cb_called && a->act_time >= 0) {
 
-                if(a->start_cb) a->start_cb(a);
-                a->start_cb_called = 1;
+        if(a->early_apply == 0 && a->get_value_cb) {
+            int32_t v_ofs = a->get_value_cb(a);
+            a->start_value += v_ofs;
+            a->end_value += v_ofs;
+        }
 
-                /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
-                remove_concurrent_anims(a);
-            }
+        resolve_time(a);
 
-            if(a->act_time >= 0) {
-                if(a->act_time > a->duration) a->act_time = a->duration;
+        if(a->start_cb) a->start_cb(a);
+        a->start_cb_called = 1;
 
-                int32_t new_value;
-                new_value = a->path_cb(a);
+        /*Do not let two animations for the same 'var' with the same 'exec_cb'*/
+        remove_concurrent_anims(a);
+    }
 
-                if(new_value != a->current_value) {
-                    a->current_value = new_value;
-                    /*Apply the calculated value*/
-                    if(a->exec_cb) a->exec_cb(a->var, new_value);
-                    if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
-                }
+    if(a->act_time < 0) return false;
 
-                /*If the time is elapsed the animation is ready*/
-                if(!state.anim_list_changed && a->act_time >= a->duration) {
-                    anim_completed_handler(a);
-                }
-            }
-        }
+    if(a->act_time > a->duration) a->act_time = a->duration;
+    return true;
+}
 
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
+/**
+ * Apply the new value of an animation and handle its completion.
+ * @param a             pointer to an animation descriptor
+ * @param new_value     the value calculated by the path of the animation
+ */
+static void anim_apply(lv_anim_t * a, int32_t new_value)
+{
+    if(new_value != a->current_value) {
+        a->current_value = new_value;
+        /*Apply the calculated value*/
+        if(a->exec_cb) a->exec_cb(a->var, new_value);
+        if(!state.anim_list_changed && a->custom_exec_cb) a->custom_exec_cb(a, new_value);
     }
 
+    /*If the time is elapsed the animation is ready*/
+    if(!state.anim_list_changed && a->act_time >= a->duration) {
+        anim_completed_handler(a);
+    }
 }
 
 /**
@@ -581,7 +659,7 @@ static void anim_completed_handler(lv_anim_t * a)
 
         /*Delete the animation from the list.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
+        anim_unlink(a);
         /*Flag that the list has changed*/
         anim_mark_list_change();
 
@@ -669,7 +747,7 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 
     lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
+    a = *hash_get_bucket(a_current->var);
     while(a != NULL) {
         bool del = false;
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
@@ -680,7 +758,7 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
            (a->var == a_current->var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
+            anim_unlink(a);
             if(a->deleted_cb != NULL) a->deleted_cb(a);
             lv_free(a);
             /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
@@ -690,9 +768,9 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
             del = true;
         }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+        /*Always start from the head of the bucket on delete, because we don't know
+         *how the animations were changed in `a->deleted_cb` */
+        a = del ? *hash_get_bucket(a_current->var) : a->hash_next;
     }
 
     return del_any;
@@ -701,7 +779,238 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 static void remove_anim(void * a)
 {
     lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
+    anim_unlink(anim);
     if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
     lv_free(a);
 }
+
+/**
+ * Remove an animation from the list and the hash table without freeing it.
+ * The iterators of the running `anim_timer` calls are moved to the next animation if needed.
+ * @param a     pointer to an animation descriptor
+ */
+static void anim_unlink(lv_anim_t * a)
+{
+    lv_anim_iter_t * iter;
+    for(iter = state.iter; iter != NULL; iter = iter->parent) {
+        if(iter->next == a) iter->next = lv_ll_get_next(anim_ll_p, a);
+    }
+
+#if LV_ANIM_BATCH_STEP
+    lv_anim_batch_t * batch = &state.batch;
+    if(batch->active && a->batch_index < batch->cnt && batch->anims[a->batch_index] == a) {
+        batch->anims[a->batch_index] = NULL;
+    }
+#endif
+
+    hash_remove(a);
+    lv_ll_remove(anim_ll_p, a);
+    state.anim_cnt--;
+}
+
+static lv_anim_t ** hash_get_bucket(const void * var)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)var >> 2);
+    h ^= h >> 16;
+    h *= 0x45d9f3b;
+    h ^= h >> 16;
+
+    return &state.hash_table[h & (state.hash_size - 1)];
+}
+
+/**
+ * Find the newest animation of a variable.
+ * @param var       the animated variable
+ * @param exec_cb   the exec callback of the animation or NULL to match any
+ * @return          the animation or NULL if not found
+ */
+static lv_anim_t * hash_find(const void * var, lv_anim_exec_xcb_t exec_cb)
+{
+    if(state.hash_table == NULL) return NULL;
+
+    /*The animations are added to the head of the buckets so it's the same order as in the list*/
+    lv_anim_t * a;
+    for(a = *hash_get_bucket(var); a != NULL; a = a->hash_next) {
+        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+            return a;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Grow the hash table to have at least as many buckets as animations.
+ * @param cnt   the number of animations
+ * @return      true: the hash table can be used (even if it couldn't be grown)
+ */
+static bool hash_reserve(uint32_t cnt)
+{
+    if(cnt <= state.hash_size) return true;
+
+    uint32_t new_size = state.hash_size ? state.hash_size * 2 : HASH_SIZE_MIN;
+    lv_anim_t ** new_table = lv_malloc_zeroed(new_size * sizeof(lv_anim_t *));
+    if(new_table == NULL) return state.hash_table != NULL;
+
+    lv_free(state.hash_table);
+    state.hash_table = new_table;
+    state.hash_size = new_size;
+
+    /*Add the animations from the oldest to keep the newest at the head of the buckets*/
+    lv_anim_t * a;
+    for(a = lv_ll_get_tail(anim_ll_p); a != NULL; a = lv_ll_get_prev(anim_ll_p, a)) {
+        hash_insert(a);
+    }
+
+    return true;
+}
+
+static void hash_insert(lv_anim_t * a)
+{
+    lv_anim_t ** bucket = hash_get_bucket(a->var);
+    a->hash_next = *bucket;
+    *bucket = a;
+}
+
+static void hash_remove(lv_anim_t * a)
+{
+    lv_anim_t ** prev_next = hash_get_bucket(a->var);
+    while(*prev_next != a) {
+        LV_ASSERT_NULL(*prev_next);
+        prev_next = &(*prev_next)->hash_next;
+    }
+
+    *prev_next = a->hash_next;
+}
+
+#if LV_ANIM_BATCH_STEP
+
+/**
+ * Make sure the batch can store a given number of animations.
+ * @param cnt   number of animations
+ * @return      true: success, false: out of memory
+ */
+static bool batch_reserve(uint32_t cnt)
+{
+    lv_anim_batch_t * batch = &state.batch;
+    if(cnt <= batch->size) return true;
+
+    uint32_t new_size = LV_MAX(cnt, batch->size * 2);
+    uint32_t elem_size = sizeof(lv_anim_t *) + 5 * sizeof(int32_t) + sizeof(uint8_t);
+    uint8_t * buf = lv_malloc(new_size * elem_size);
+    if(buf == NULL) return false;
+
+    lv_free(batch->anims);
+
+    /*Allocate the arrays together in order of alignment*/
+    batch->anims = (lv_anim_t **)buf;
+    buf += new_size * sizeof(lv_anim_t *);
+    batch->act_time = (int32_t *)buf;
+    batch->duration = batch->act_time + new_size;
+    batch->start_value = batch->duration + new_size;
+    batch->end_value = batch->start_value + new_size;
+    batch->value = batch->end_value + new_size;
+    batch->path_type = (uint8_t *)(batch->value + new_size);
+    batch->size = new_size;
+
+    return true;
+}
+
+/**
+ * Step all the animations in a batch: first start them and collect their parameters,
+ * calculate the new values together and apply them in the order of the list.
+ */
+static void batch_step(void)
+{
+    lv_anim_batch_t * batch = &state.batch;
+    batch->cnt = 0;
+    batch->active = true;
+
+    lv_anim_iter_t iter;
+    iter.next = lv_ll_get_head(anim_ll_p);
+    iter.parent = state.iter;
+    state.iter = &iter;
+
+    while(iter.next != NULL) {
+        lv_anim_t * a = iter.next;
+        iter.next = lv_ll_get_next(anim_ll_p, a);
+
+        if(!anim_step_begin(a)) continue;
+
+        /*Only the animations already in the list are stepped, but be sure*/
+        if(batch->cnt >= batch->size) {
+            anim_apply(a, a->path_cb(a));
+            continue;
+        }
+
+        uint32_t i = batch->cnt;
+        batch->anims[i] = a;
+        batch->act_time[i] = a->act_time;
+        batch->duration[i] = a->duration;
+        batch->start_value[i] = a->start_value;
+        batch->end_value[i] = a->end_value;
+        batch->path_type[i] = (uint8_t)get_path_type(a->path_cb);
+        a->batch_index = i;
+        batch->cnt++;
+    }
+
+    state.iter = iter.parent;
+
+    batch_calc_values(batch);
+
+    uint32_t i;
+    for(i = 0; i < batch->cnt; i++) {
+        lv_anim_t * a = batch->anims[i];
+        if(a == NULL) continue; /*Deleted by a callback*/
+
+        state.anim_list_changed = false;
+        int32_t new_value = batch->path_type[i] == ANIM_PATH_CUSTOM ? a->path_cb(a) : batch->value[i];
+        anim_apply(a, new_value);
+    }
+
+    batch->active = false;
+}
+
+/**
+ * Calculate the values of the animations with built-in paths.
+ * Gives the same result as `lv_anim_path_linear` and `lv_anim_path_cubic_bezier`.
+ * @param batch     the collected animations
+ */
+static void batch_calc_values(lv_anim_batch_t * batch)
+{
+    uint32_t cnt = batch->cnt;
+    int32_t * step = batch->value;
+    uint32_t i;
+
+    /*Map the time to [0..LV_ANIM_RESOLUTION]. (`act_time` is already in [0..duration])*/
+    for(i = 0; i < cnt; i++) {
+        int32_t act_time = batch->act_time[i];
+        int32_t duration = batch->duration[i];
+        step[i] = act_time >= duration ? LV_ANIM_RESOLUTION : (act_time * LV_ANIM_RESOLUTION) / duration;
+    }
+
+    /*Apply the easing. LV_BEZIER_VAL_MAX is the same as LV_ANIM_RESOLUTION*/
+    for(i = 0; i < cnt; i++) {
+        uint8_t type = batch->path_type[i];
+        if(type >= ANIM_PATH_EASE_IN) {
+            const lv_anim_bezier3_para_t * para = &batch_bezier_paras[type];
+            step[i] = lv_cubic_bezier(step[i], para->x1, para->y1, para->x2, para->y2);
+        }
+    }
+
+    for(i = 0; i < cnt; i++) {
+        int32_t start_value = batch->start_value[i];
+        step[i] = ((step[i] * (batch->end_value[i] - start_value)) >> LV_ANIM_RES_SHIFT) + start_value;
+    }
+}
+
+static anim_path_type_t get_path_type(lv_anim_path_cb_t path_cb)
+{
+    if(path_cb == lv_anim_path_linear) return ANIM_PATH_LINEAR;
+    if(path_cb == lv_anim_path_ease_in) return ANIM_PATH_EASE_IN;
+    if(path_cb == lv_anim_path_ease_out) return ANIM_PATH_EASE_OUT;
+    if(path_cb == lv_anim_path_ease_in_out) return ANIM_PATH_EASE_IN_OUT;
+    return ANIM_PATH_CUSTOM;
+}
+
+#endif /*LV_ANIM_BATCH_STEP*/
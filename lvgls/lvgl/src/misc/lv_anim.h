@@ -147,6 +147,11 @@ struct lv_anim_t {
 
     /* Animation system use these - user shouldn't set */
     uint32_t last_timer_run;
+    lv_anim_t * hash_next;        /**< Next animation in the same bucket of the hash table of `var`s.
+                                   *   Therefore `var` shouldn't be changed while the animation is running.*/
+#if LV_ANIM_BATCH_STEP
+    uint32_t batch_index;         /**< Index in the batch of the animations stepped together*/
+#endif
     uint8_t playback_now : 1;     /**< Play back is in progress*/
     uint8_t run_round : 1;        /**< Indicates the animation has run in this round*/
     uint8_t start_cb_called : 1;  /**< Indicates that the `start_cb` was already called*/
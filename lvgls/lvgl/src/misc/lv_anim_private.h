@@ -24,11 +24,40 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Iterator of `anim_timer`. Updated if the next animation is deleted meanwhile.*/
+typedef struct lv_anim_iter_t {
+    lv_anim_t * next;                   /**< The animation to step after the current one*/
+    struct lv_anim_iter_t * parent;     /**< Iterator of the outer `anim_timer` call if it's called recursively*/
+} lv_anim_iter_t;
+
+#if LV_ANIM_BATCH_STEP
+/** Parameters of the animations stepped together in structure-of-arrays layout*/
+typedef struct {
+    lv_anim_t ** anims;         /**< The animations in the order of the list. NULL if deleted meanwhile.*/
+    int32_t * act_time;
+    int32_t * duration;
+    int32_t * start_value;
+    int32_t * end_value;
+    int32_t * value;            /**< The calculated new values*/
+    uint8_t * path_type;        /**< The built-in path of the animation or custom*/
+    uint32_t cnt;               /**< Number of animations in the batch*/
+    uint32_t size;              /**< Number of allocated elements*/
+    bool active;                /**< The exec callbacks of the batch are being called*/
+} lv_anim_batch_t;
+#endif
+
 typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     lv_timer_t * timer;
     lv_ll_t anim_ll;
+    lv_anim_t ** hash_table;    /**< Buckets of the animations by `var`, chained by `lv_anim_t::hash_next`*/
+    uint32_t hash_size;         /**< Number of buckets (power of 2)*/
+    uint32_t anim_cnt;          /**< Number of animations in `anim_ll`*/
+    lv_anim_iter_t * iter;      /**< Iterator of the innermost running `anim_timer`*/
+#if LV_ANIM_BATCH_STEP
+    lv_anim_batch_t batch;
+#endif
 } lv_anim_state_t;
 
 /**********************
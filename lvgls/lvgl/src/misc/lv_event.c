@@ -10,6 +10,7 @@
 #include "../core/lv_global.h"
 #include "../stdlib/lv_mem.h"
 #include "lv_assert.h"
+#include "lv_math.h"
 #include "lv_types.h"
 
 /*********************
@@ -18,6 +19,7 @@
 
 #define event_head LV_GLOBAL_DEFAULT()->event_header
 #define event_last_id LV_GLOBAL_DEFAULT()->event_last_register_id
+#define event_sent_cnt LV_GLOBAL_DEFAULT()->event_sent_cnt
 
 /**********************
  *      TYPEDEFS
@@ -26,6 +28,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void code_mask_add(lv_event_list_t * list, uint32_t filter);
+static void code_mask_update(lv_event_list_t * list);
 
 /**********************
  *  STATIC VARIABLES
@@ -64,9 +68,18 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
 {
     if(list == NULL) return LV_RESULT_OK;
 
+    /*Return quickly if there is no descriptor for this event code*/
+    if(preprocess) {
+        if(!list->has_preprocess) return LV_RESULT_OK;
+    }
+    else if(!list->has_all) {
+        if((uint32_t)e->code >= LV_EVENT_LAST) return LV_RESULT_OK;
+        if((list->code_mask[e->code >> 5] & ((uint32_t)1 << (e->code & 0x1f))) == 0) return LV_RESULT_OK;
+    }
+
     uint32_t i = 0;
-    lv_event_dsc_t ** dsc = lv_array_front(list);
-    uint32_t size = lv_array_size(list);
+    lv_event_dsc_t ** dsc = lv_array_front(&list->array);
+    uint32_t size = lv_array_size(&list->array);
     for(i = 0; i < size; i++) {
         if(dsc[i]->cb == NULL) continue;
         bool is_preprocessed = (dsc[i]->filter & LV_EVENT_PREPROCESS) != 0;
@@ -95,12 +108,13 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     dsc->filter = filter;
     dsc->user_data = user_data;
 
-    if(lv_array_size(list) == 0) {
+    if(lv_array_size(&list->array) == 0) {
         /*event list hasn't been initialized.*/
-        lv_array_init(list, 1, sizeof(lv_event_dsc_t *));
+        lv_array_init(&list->array, 1, sizeof(lv_event_dsc_t *));
     }
 
-    lv_array_push_back(list, &dsc);
+    lv_array_push_back(&list->array, &dsc);
+    code_mask_add(list, filter);
     return dsc;
 }
 
@@ -109,12 +123,13 @@ bool lv_event_remove_dsc(lv_event_list_t * list, lv_event_dsc_t * dsc)
     LV_ASSERT_NULL(list);
     LV_ASSERT_NULL(dsc);
 
-    int size = lv_array_size(list);
-    lv_event_dsc_t ** events = lv_array_front(list);
+    int size = lv_array_size(&list->array);
+    lv_event_dsc_t ** events = lv_array_front(&list->array);
     for(int i = 0; i < size; i++) {
         if(events[i] == dsc) {
             lv_free(dsc);
-            lv_array_remove(list, i);
+            lv_array_remove(&list->array, i);
+            code_mask_update(list);
             return true;
         }
     }
@@ -125,14 +140,14 @@ bool lv_event_remove_dsc(lv_event_list_t * list, lv_event_dsc_t * dsc)
 uint32_t lv_event_get_count(lv_event_list_t * list)
 {
     LV_ASSERT_NULL(list);
-    return lv_array_size(list);
+    return lv_array_size(&list->array);
 }
 
 lv_event_dsc_t * lv_event_get_dsc(lv_event_list_t * list, uint32_t index)
 {
     LV_ASSERT_NULL(list);
     lv_event_dsc_t ** dsc;
-    dsc = lv_array_at(list, index);
+    dsc = lv_array_at(&list->array, index);
     return dsc ? *dsc : NULL;
 }
 
@@ -154,18 +169,21 @@ bool lv_event_remove(lv_event_list_t * list, uint32_t index)
     LV_ASSERT_NULL(list);
     lv_event_dsc_t * dsc = lv_event_get_dsc(list, index);
     lv_free(dsc);
-    return lv_array_remove(list, index);
+    bool res = lv_array_remove(&list->array, index);
+    code_mask_update(list);
+    return res;
 }
 
 void lv_event_remove_all(lv_event_list_t * list)
 {
     LV_ASSERT_NULL(list);
-    int size = lv_array_size(list);
-    lv_event_dsc_t ** dsc = lv_array_front(list);
+    int size = lv_array_size(&list->array);
+    lv_event_dsc_t ** dsc = lv_array_front(&list->array);
     for(int i = 0; i < size; i++) {
         lv_free(dsc[i]);
     }
-    lv_array_deinit(list);
+    lv_array_deinit(&list->array);
+    code_mask_update(list);
 }
 
 void * lv_event_get_current_target(lv_event_t * e)
@@ -219,6 +237,47 @@ void lv_event_mark_deleted(void * target)
     }
 }
 
+#if LV_USE_PROFILER
+void lv_event_count_sent(lv_event_code_t code)
+{
+    event_sent_cnt[LV_MIN((uint32_t)code, LV_EVENT_LAST)]++;
+}
+
+uint32_t lv_event_get_sent_count(lv_event_code_t code)
+{
+    return event_sent_cnt[LV_MIN((uint32_t)code, LV_EVENT_LAST)];
+}
+#endif
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+static void code_mask_add(lv_event_list_t * list, uint32_t filter)
+{
+    if(filter & LV_EVENT_PREPROCESS) {
+        list->has_preprocess = 1;
+        return;
+    }
+
+    if(filter == LV_EVENT_ALL || filter >= LV_EVENT_LAST) list->has_all = 1;
+    else list->code_mask[filter >> 5] |= (uint32_t)1 << (filter & 0x1f);
+}
+
+/**
+ * Rebuild the mask of the subscribed event codes after removing descriptors
+ * @param list      pointer to an event list
+ */
+static void code_mask_update(lv_event_list_t * list)
+{
+    lv_memzero(list->code_mask, sizeof(list->code_mask));
+    list->has_all = 0;
+    list->has_preprocess = 0;
+
+    uint32_t size = lv_array_size(&list->array);
+    lv_event_dsc_t ** dsc = lv_array_front(&list->array);
+    uint32_t i;
+    for(i = 0; i < size; i++) {
+        code_mask_add(list, dsc[i]->filter);
+    }
+}
@@ -113,7 +113,12 @@ typedef enum {
                                       before the class default event processing */
 } lv_event_code_t;
 
-typedef lv_array_t lv_event_list_t;
+typedef struct {
+    lv_array_t array;
+    uint32_t code_mask[(LV_EVENT_LAST + 31) / 32];  /**< Bit `n` is set if there is a descriptor for the event code `n`*/
+    uint8_t has_all : 1;            /**< There is a descriptor for all events or a custom event code*/
+    uint8_t has_preprocess : 1;     /**< There is a descriptor with `LV_EVENT_PREPROCESS`*/
+} lv_event_list_t;
 
 /**
  * @brief Event callback.
@@ -138,6 +143,16 @@ bool lv_event_remove(lv_event_list_t * list, uint32_t index);
 
 void lv_event_remove_all(lv_event_list_t * list);
 
+#if LV_USE_PROFILER
+/**
+ * Get how many times an event was sent to the objects, displays and input devices.
+ * Only counted if the profiler is enabled.
+ * @param code      an event code. All the custom event codes are counted together with `LV_EVENT_LAST`
+ * @return          number of times the event was sent
+ */
+uint32_t lv_event_get_sent_count(lv_event_code_t code);
+#endif
+
 /**
  * Get the object originally targeted by the event. It's the same even if the event is bubbled.
  * @param e     pointer to the event descriptor
@@ -62,6 +62,14 @@ void lv_event_pop(lv_event_t * e);
  */
 void lv_event_mark_deleted(void * target);
 
+#if LV_USE_PROFILER
+/**
+ * Count a sent event for `lv_event_get_sent_count()`
+ * @param code      the code of the sent event
+ */
+void lv_event_count_sent(lv_event_code_t code);
+#endif
+
 /**********************
  *      MACROS
  **********************/
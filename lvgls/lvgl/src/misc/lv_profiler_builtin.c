@@ -257,6 +257,24 @@ static void flush_no_lock(void)
 #endif
         profiler_ctx->config.flush_cb(buf);
     }
+
+    /*Add the number of sent events as counters*/
+    uint32_t tick = profiler_ctx->config.tick_get_cb();
+    uint32_t sec = tick / tick_per_sec;
+    uint32_t usec = (tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
+    uint32_t code;
+    for(code = 0; code <= LV_EVENT_LAST; code++) {
+        uint32_t cnt = lv_event_get_sent_count(code);
+        if(cnt == 0) continue;
+
+        lv_snprintf(buf, sizeof(buf),
+                    "   LVGL-1 [0] %" LV_PRIu32 ".%06" LV_PRIu32 ": tracing_mark_write: C|1|event_%" LV_PRIu32 "|%" LV_PRIu32 "\n",
+                    sec,
+                    usec,
+                    code,
+                    cnt);
+        profiler_ctx->config.flush_cb(buf);
+    }
 }
 
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -19,6 +19,12 @@
 #define lv_style_custom_prop_flag_lookup_table_size LV_GLOBAL_DEFAULT()->style_custom_table_size
 #define lv_style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define last_custom_prop_id LV_GLOBAL_DEFAULT()->style_last_custom_prop_id
+#if LV_OBJ_STYLE_RES_CACHE_SIZE
+/*Invalidate the resolved style properties of the objects*/
+#define STYLE_RES_CACHE_INVALIDATE() LV_GLOBAL_DEFAULT()->style_res_cache_gen++
+#else
+#define STYLE_RES_CACHE_INVALIDATE()
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -27,6 +33,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static uint32_t find_prop_index(const lv_style_prop_t * props, uint32_t prop_cnt, lv_style_prop_t prop,
+                                bool * found);
 
 /**********************
  *  GLOBAL VARIABLES
@@ -185,6 +193,7 @@ void lv_style_init(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    STYLE_RES_CACHE_INVALIDATE();
 }
 
 void lv_style_reset(lv_style_t * style)
@@ -196,6 +205,7 @@ void lv_style_reset(lv_style_t * style)
 #if LV_USE_ASSERT_STYLE
     style->sentinel = LV_STYLE_SENTINEL_VALUE;
 #endif
+    STYLE_RES_CACHE_INVALIDATE();
 }
 
 lv_style_prop_t lv_style_register_prop(uint8_t flag)
@@ -277,6 +287,7 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             }
 
             lv_free(old_values);
+            STYLE_RES_CACHE_INVALIDATE();
             return true;
         }
     }
@@ -294,18 +305,19 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     }
 
     LV_ASSERT(prop != LV_STYLE_PROP_INV);
+    STYLE_RES_CACHE_INVALIDATE();
 
-    lv_style_prop_t * props;
-    int32_t i;
+    lv_style_prop_t * props = NULL;
+    uint32_t i = 0;
+    bool found = false;
 
     if(style->values_and_props) {
         props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        for(i = style->prop_cnt - 1; i >= 0; i--) {
-            if(props[i] == prop) {
-                lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
-                values[i] = value;
-                return;
-            }
+        i = find_prop_index(props, style->prop_cnt, prop, &found);
+        if(found) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            values[i] = value;
+            return;
         }
     }
 
@@ -314,25 +326,101 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     if(values_and_props == NULL) return;
     style->values_and_props = values_and_props;
 
-    props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-    /*Shift all props to make place for the value before them*/
-    for(i = style->prop_cnt - 1; i >= 0; i--) {
-        props[i + sizeof(lv_style_value_t) / sizeof(lv_style_prop_t)] = props[i];
+    /*The props are moved forward with the size of the new value. Insert the new prop at `i` meanwhile.
+     *Go backward as the source and destination areas overlap*/
+    lv_style_prop_t * old_props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    props = old_props + sizeof(lv_style_value_t);
+    int32_t j;
+    for(j = style->prop_cnt - 1; j >= (int32_t)i; j--) {
+        props[j + 1] = old_props[j];
     }
-    style->prop_cnt++;
+    for(; j >= 0; j--) {
+        props[j] = old_props[j];
+    }
+    props[i] = prop;
 
-    /*Go to the new position with the props*/
-    props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    /*Make place for the new value at `i` too*/
     lv_style_value_t * values = (lv_style_value_t *)values_and_props;
-
-    /*Set the new property and value*/
-    props[style->prop_cnt - 1] = prop;
-    values[style->prop_cnt - 1] = value;
+    lv_memmove(&values[i + 1], &values[i], (style->prop_cnt - i) * sizeof(lv_style_value_t));
+    values[i] = value;
+    style->prop_cnt++;
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
 }
 
+void lv_style_set_props(lv_style_t * style, const lv_style_prop_t props[], const lv_style_value_t values[],
+                        uint32_t cnt)
+{
+    LV_ASSERT_STYLE(style);
+
+    if(lv_style_is_const(style)) {
+        LV_LOG_ERROR("Cannot set property of constant style");
+        return;
+    }
+
+    if(cnt == 0) return;
+    STYLE_RES_CACHE_INVALIDATE();
+
+    const lv_style_prop_t * old_props = NULL;
+    if(style->values_and_props) {
+        old_props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+    }
+
+    /*Count the properties which are not in the style yet*/
+    uint32_t new_cnt = style->prop_cnt;
+    uint32_t i;
+    uint32_t j;
+    bool found;
+    for(i = 0; i < cnt; i++) {
+        LV_ASSERT(props[i] != LV_STYLE_PROP_INV);
+        found = false;
+        if(old_props) find_prop_index(old_props, style->prop_cnt, props[i], &found);
+        if(found) continue;
+
+        /*Count the duplicates only once*/
+        for(j = 0; j < i; j++) {
+            if(props[j] == props[i]) break;
+        }
+        if(j == i) new_cnt++;
+    }
+
+    LV_ASSERT(new_cnt < 255);
+
+    /*Allocate the final size at once and copy the current (sorted) properties there*/
+    uint8_t * values_and_props = style->values_and_props;
+    if(new_cnt != style->prop_cnt) {
+        values_and_props = lv_malloc(new_cnt * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t)));
+        if(values_and_props == NULL) return;
+
+        if(old_props) {
+            lv_memcpy(values_and_props, style->values_and_props, style->prop_cnt * sizeof(lv_style_value_t));
+            lv_memcpy(values_and_props + new_cnt * sizeof(lv_style_value_t), old_props, style->prop_cnt);
+        }
+    }
+
+    lv_style_value_t * new_values = (lv_style_value_t *)values_and_props;
+    lv_style_prop_t * new_props = values_and_props + new_cnt * sizeof(lv_style_value_t);
+    uint32_t act_cnt = style->prop_cnt;
+    for(i = 0; i < cnt; i++) {
+        uint32_t idx = find_prop_index(new_props, act_cnt, props[i], &found);
+        if(!found) {
+            lv_memmove(&new_values[idx + 1], &new_values[idx], (act_cnt - idx) * sizeof(lv_style_value_t));
+            lv_memmove(&new_props[idx + 1], &new_props[idx], (act_cnt - idx) * sizeof(lv_style_prop_t));
+            new_props[idx] = props[i];
+            act_cnt++;
+        }
+        new_values[idx] = values[i];
+        style->has_group |= (uint32_t)1 << lv_style_get_prop_group(props[i]);
+    }
+
+    if(values_and_props != style->values_and_props) {
+        lv_free(style->values_and_props);
+        style->values_and_props = values_and_props;
+        style->prop_cnt = new_cnt;
+    }
+}
+
 lv_style_res_t lv_style_get_prop(const lv_style_t * style, lv_style_prop_t prop, lv_style_value_t * value)
 {
     return lv_style_get_prop_inlined(style, prop, value);
@@ -440,3 +528,26 @@ uint8_t lv_style_prop_lookup_flags(lv_style_prop_t prop)
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+/**
+ * Find a property in the sorted property IDs of a style
+ * @param props     the property IDs in ascending order
+ * @param prop_cnt  number of elements in `props`
+ * @param prop      the property to find
+ * @param found     set to true if `prop` is in `props`
+ * @return          index of `prop` if found, else the index where it should be inserted
+ */
+static uint32_t find_prop_index(const lv_style_prop_t * props, uint32_t prop_cnt, lv_style_prop_t prop,
+                                bool * found)
+{
+    uint32_t min = 0;
+    uint32_t max = prop_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) >> 1;
+        if(props[mid] < prop) min = mid + 1;
+        else max = mid;
+    }
+
+    *found = min < prop_cnt && props[min] == prop;
+    return min;
+}
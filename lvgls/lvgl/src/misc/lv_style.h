@@ -370,7 +370,7 @@ typedef struct {
     uint32_t sentinel;
 #endif
 
-    void * values_and_props;
+    void * values_and_props;    /**< `prop_cnt` values followed by the `prop_cnt` property IDs in ascending order*/
 
     uint32_t has_group;
     uint8_t prop_cnt;   /**< 255 means it's a constant style*/
@@ -447,6 +447,17 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop);
  */
 void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_t value);
 
+/**
+ * Set the values of several properties in a style at once.
+ * The style is reallocated only once, so it's faster than calling `lv_style_set_prop()` for each property.
+ * @param style     pointer to style
+ * @param props     array of property IDs (e.g. `LV_STYLE_BG_COLOR`)
+ * @param values    array of values for the properties in `props`
+ * @param cnt       number of elements in `props` and `values`
+ */
+void lv_style_set_props(lv_style_t * style, const lv_style_prop_t props[], const lv_style_value_t values[],
+                        uint32_t cnt);
+
 /**
  * Get the value of a property
  * @param style pointer to a style
@@ -508,12 +519,17 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
         }
     }
     else {
+        /*The properties are sorted by their ID so use binary search*/
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
-        uint32_t i;
-        for(i = 0; i < style->prop_cnt; i++) {
-            if(props[i] == prop) {
+        int32_t min = 0;
+        int32_t max = (int32_t)style->prop_cnt - 1;
+        while(min <= max) {
+            int32_t mid = (min + max) >> 1;
+            if(props[mid] < prop) min = mid + 1;
+            else if(props[mid] > prop) max = mid - 1;
+            else {
                 lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
-                *value = values[i];
+                *value = values[mid];
                 return LV_STYLE_RES_FOUND;
             }
         }
@@ -554,40 +570,56 @@ uint8_t lv_style_prop_lookup_flags(lv_style_prop_t prop);
 
 static inline void lv_style_set_size(lv_style_t * style, int32_t width, int32_t height)
 {
-    lv_style_set_width(style, width);
-    lv_style_set_height(style, height);
+    const lv_style_prop_t props[] = {LV_STYLE_WIDTH, LV_STYLE_HEIGHT};
+    lv_style_value_t values[2] = {{0}, {0}};
+    values[0].num = width;
+    values[1].num = height;
+    lv_style_set_props(style, props, values, 2);
 }
 
 static inline void lv_style_set_pad_all(lv_style_t * style, int32_t value)
 {
-    lv_style_set_pad_left(style, value);
-    lv_style_set_pad_right(style, value);
-    lv_style_set_pad_top(style, value);
-    lv_style_set_pad_bottom(style, value);
+    const lv_style_prop_t props[] = {LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT, LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM};
+    lv_style_value_t v = {0};
+    v.num = value;
+    const lv_style_value_t values[] = {v, v, v, v};
+    lv_style_set_props(style, props, values, 4);
 }
 
 static inline void lv_style_set_pad_hor(lv_style_t * style, int32_t value)
 {
-    lv_style_set_pad_left(style, value);
-    lv_style_set_pad_right(style, value);
+    const lv_style_prop_t props[] = {LV_STYLE_PAD_LEFT, LV_STYLE_PAD_RIGHT};
+    lv_style_value_t v = {0};
+    v.num = value;
+    const lv_style_value_t values[] = {v, v};
+    lv_style_set_props(style, props, values, 2);
 }
 
 static inline void lv_style_set_pad_ver(lv_style_t * style, int32_t value)
 {
-    lv_style_set_pad_top(style, value);
-    lv_style_set_pad_bottom(style, value);
+    const lv_style_prop_t props[] = {LV_STYLE_PAD_TOP, LV_STYLE_PAD_BOTTOM};
+    lv_style_value_t v = {0};
+    v.num = value;
+    const lv_style_value_t values[] = {v, v};
+    lv_style_set_props(style, props, values, 2);
 }
 
 static inline void lv_style_set_pad_gap(lv_style_t * style, int32_t value)
 {
-    lv_style_set_pad_row(style, value);
-    lv_style_set_pad_column(style, value);
+    const lv_style_prop_t props[] = {LV_STYLE_PAD_ROW, LV_STYLE_PAD_COLUMN};
+    lv_style_value_t v = {0};
+    v.num = value;
+    const lv_style_value_t values[] = {v, v};
+    lv_style_set_props(style, props, values, 2);
 }
 
 static inline void lv_style_set_transform_scale(lv_style_t * style, int32_t value)
 {
-    lv_style_set_transform_scale_x(style, value);
-    lv_style_set_transform_scale_y(style, value);
+    const lv_style_prop_t props[] = {LV_STYLE_TRANSFORM_SCALE_X, LV_STYLE_TRANSFORM_SCALE_Y};
+    lv_style_value_t v = {0};
+    v.num = value;
+    const lv_style_value_t values[] = {v, v};
+    lv_style_set_props(style, props, values, 2);
 }
 
 /**
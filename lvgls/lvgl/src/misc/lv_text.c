@@ -14,12 +14,15 @@
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 #include "../misc/lv_types.h"
+#include "../core/lv_global.h"
 
 /*********************
  *      DEFINES
  *********************/
 #define NO_BREAK_FOUND UINT32_MAX
 
+#define text_layout_cache_p (LV_GLOBAL_DEFAULT()->text_layout_cache)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -28,6 +31,14 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static void text_get_size_core(lv_point_t * size_res, const char * text, const lv_font_t * font, int32_t letter_space,
+                               int32_t line_space, int32_t max_width, lv_text_flag_t flag, const lv_text_layout_t * layout);
+static uint32_t text_hash(const char * text, uint32_t * len);
+static bool text_layout_create(lv_text_layout_t * layout, uint32_t len);
+static bool text_layout_create_cb(lv_text_layout_t * layout, void * user_data);
+static void text_layout_free_cb(lv_text_layout_t * layout, void * user_data);
+static lv_cache_compare_res_t text_layout_compare_cb(const lv_text_layout_t * lhs, const lv_text_layout_t * rhs);
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
     static uint8_t lv_text_utf8_size(const char * str);
     static uint32_t lv_text_unicode_to_utf8(uint32_t letter_uni);
@@ -100,40 +111,102 @@ void lv_text_get_size(lv_point_t * size_res, const char * text, const lv_font_t
 
     if(flag & LV_TEXT_FLAG_EXPAND) max_width = LV_COORD_MAX;
 
-    uint32_t line_start     = 0;
-    uint32_t new_line_start = 0;
-    uint16_t letter_height = lv_font_get_line_height(font);
+    /*Reuse the line breaks if the text was already laid out this way*/
+    lv_text_layout_t * layout = lv_text_layout_acquire(text, font, letter_space, max_width, flag);
+    text_get_size_core(size_res, text, font, letter_space, line_space, max_width, flag, layout);
+    if(layout) lv_text_layout_release(layout);
+}
 
-    /*Calc. the height and longest line*/
-    while(text[line_start] != '\0') {
-        new_line_start += lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+void lv_text_layout_cache_init(uint32_t size)
+{
+    if(size == 0 || text_layout_cache_p != NULL) return;
 
-        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(int32_t)) {
-            LV_LOG_WARN("integer overflow while calculating text height");
-            return;
-        }
-        else {
-            size_res->y += letter_height;
-            size_res->y += line_space;
-        }
+    text_layout_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_text_layout_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) text_layout_compare_cb,
+        .create_cb = (lv_cache_create_cb_t) text_layout_create_cb,
+        .free_cb = (lv_cache_free_cb_t) text_layout_free_cb
+    });
 
-        /*Calculate the longest line*/
-        int32_t act_line_length = lv_text_get_width(&text[line_start], new_line_start - line_start, font, letter_space);
+    if(text_layout_cache_p) lv_cache_set_name(text_layout_cache_p, "TEXT_LAYOUT");
+}
 
-        size_res->x = LV_MAX(act_line_length, size_res->x);
-        line_start  = new_line_start;
+void lv_text_layout_cache_deinit(void)
+{
+    if(text_layout_cache_p == NULL) return;
+
+    lv_cache_destroy(text_layout_cache_p, NULL);
+    text_layout_cache_p = NULL;
+}
+
+void lv_text_layout_cache_drop(void)
+{
+    if(text_layout_cache_p == NULL) return;
+
+    lv_cache_drop_all(text_layout_cache_p, NULL);
+}
+
+lv_text_layout_t * lv_text_layout_acquire(const char * text, const lv_font_t * font, int32_t letter_space,
+                                          int32_t max_width, lv_text_flag_t flag)
+{
+    if(text_layout_cache_p == NULL) return NULL;
+    if(text == NULL || font == NULL) return NULL;
+
+    /*The width is not used in these cases so don't let it create different layouts*/
+    if(flag & (LV_TEXT_FLAG_EXPAND | LV_TEXT_FLAG_FIT)) max_width = LV_COORD_MAX;
+
+    uint32_t len;
+    lv_text_layout_t layout;
+    lv_memzero(&layout, sizeof(layout));
+    layout.hash = text_hash(text, &len);
+    layout.text = text;
+    layout.font = font;
+    layout.letter_space = letter_space;
+    layout.max_width = max_width;
+    layout.flag = flag;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(text_layout_cache_p, &layout, NULL);
+    if(entry) return lv_cache_entry_get_data(entry);
+
+    /*Break the text into lines outside of the cache's lock and add it only when it's ready*/
+    if(!text_layout_create(&layout, len)) return NULL;
+
+    bool added = false;
+    if(layout.slot.size <= lv_cache_get_max_size(text_layout_cache_p, NULL)) {
+        entry = lv_cache_acquire_or_create(text_layout_cache_p, &layout, &added);
     }
 
-    /*Make the text one line taller if the last character is '\n' or '\r'*/
-    if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
-        size_res->y += letter_height + line_space;
+    /*Not added if it's too large or another thread has added the same layout in the meantime*/
+    if(!added) text_layout_free_cb(&layout, NULL);
+
+    return entry ? lv_cache_entry_get_data(entry) : NULL;
+}
+
+void lv_text_layout_release(lv_text_layout_t * layout)
+{
+    LV_ASSERT_NULL(layout);
+
+    lv_cache_release(text_layout_cache_p, lv_cache_entry_get_entry(layout, sizeof(lv_text_layout_t)), NULL);
+}
+
+const lv_text_layout_line_t * lv_text_layout_get_line(const lv_text_layout_t * layout, uint32_t line_start)
+{
+    LV_ASSERT_NULL(layout);
+
+    /*Find the first line ending after `line_start`*/
+    uint32_t min = 0;
+    uint32_t max = layout->line_cnt;
+    while(min < max) {
+        uint32_t mid = (min + max) / 2;
+        if(layout->lines[mid].end <= line_start) min = mid + 1;
+        else max = mid;
     }
 
-    /*Correction with the last line space or set the height manually if the text is empty*/
-    if(size_res->y == 0)
-        size_res->y = letter_height;
-    else
-        size_res->y -= line_space;
+    if(min >= layout->line_cnt) return NULL;
+
+    /*It has to start exactly at `line_start`*/
+    uint32_t start = min == 0 ? 0 : layout->lines[min - 1].end;
+    return start == line_start ? &layout->lines[min] : NULL;
 }
 
 /**
@@ -454,6 +527,155 @@ void lv_text_encoded_letter_next_2(const char * txt, uint32_t * letter, uint32_t
     *letter_next = *letter != '\0' ? lv_text_encoded_next(&txt[*ofs], NULL) : 0;
 }
 
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void text_get_size_core(lv_point_t * size_res, const char * text, const lv_font_t * font, int32_t letter_space,
+                               int32_t line_space, int32_t max_width, lv_text_flag_t flag, const lv_text_layout_t * layout)
+{
+    uint32_t line_start     = 0;
+    uint32_t new_line_start = 0;
+    uint32_t line_idx = 0;
+    uint16_t letter_height = lv_font_get_line_height(font);
+
+    /*Calc. the height and longest line*/
+    while(text[line_start] != '\0') {
+        if(layout) new_line_start = layout->lines[line_idx].end;
+        else new_line_start += lv_text_get_next_line(&text[line_start], font, letter_space, max_width, NULL, flag);
+
+        if((unsigned long)size_res->y + (unsigned long)letter_height + (unsigned long)line_space > LV_MAX_OF(int32_t)) {
+            LV_LOG_WARN("integer overflow while calculating text height");
+            return;
+        }
+        else {
+            size_res->y += letter_height;
+            size_res->y += line_space;
+        }
+
+        /*Calculate the longest line*/
+        int32_t act_line_length;
+        if(layout) act_line_length = layout->lines[line_idx].width;
+        else act_line_length = lv_text_get_width(&text[line_start], new_line_start - line_start, font, letter_space);
+
+        size_res->x = LV_MAX(act_line_length, size_res->x);
+        line_start  = new_line_start;
+        line_idx++;
+    }
+
+    /*Make the text one line taller if the last character is '\n' or '\r'*/
+    if((line_start != 0) && (text[line_start - 1] == '\n' || text[line_start - 1] == '\r')) {
+        size_res->y += letter_height + line_space;
+    }
+
+    /*Correction with the last line space or set the height manually if the text is empty*/
+    if(size_res->y == 0)
+        size_res->y = letter_height;
+    else
+        size_res->y -= line_space;
+}
+
+static uint32_t text_hash(const char * text, uint32_t * len)
+{
+    /*FNV-1a*/
+    uint32_t hash = 2166136261u;
+    uint32_t i;
+    for(i = 0; text[i] != '\0'; i++) {
+        hash ^= (uint8_t)text[i];
+        hash *= 16777619u;
+    }
+
+    *len = i;
+    return hash;
+}
+
+static bool text_layout_create(lv_text_layout_t * layout, uint32_t len)
+{
+    char * text = lv_malloc(len + 1);
+    if(text == NULL) return false;
+    lv_memcpy(text, layout->text, len + 1);
+
+    uint32_t line_cap = 4;
+    lv_text_layout_line_t * lines = lv_malloc(line_cap * sizeof(lv_text_layout_line_t));
+    if(lines == NULL) {
+        lv_free(text);
+        return false;
+    }
+
+    uint32_t line_cnt = 0;
+    uint32_t line_start = 0;
+    while(text[line_start] != '\0') {
+        uint32_t line_end = line_start + lv_text_get_next_line(&text[line_start], layout->font, layout->letter_space,
+                                                               layout->max_width, NULL, layout->flag);
+        if(line_cnt == line_cap) {
+            line_cap *= 2;
+            lv_text_layout_line_t * new_lines = lv_realloc(lines, line_cap * sizeof(lv_text_layout_line_t));
+            if(new_lines == NULL) {
+                lv_free(lines);
+                lv_free(text);
+                return false;
+            }
+            lines = new_lines;
+        }
+
+        lines[line_cnt].end = line_end;
+        lines[line_cnt].width = lv_text_get_width(&text[line_start], line_end - line_start, layout->font,
+                                                  layout->letter_space);
+        line_cnt++;
+        line_start = line_end;
+    }
+
+    layout->text = text;
+    layout->lines = lines;
+    layout->line_cnt = line_cnt;
+    layout->slot.size = sizeof(lv_text_layout_t) + len + 1 + line_cap * sizeof(lv_text_layout_line_t);
+
+    return true;
+}
+
+static bool text_layout_create_cb(lv_text_layout_t * layout, void * user_data)
+{
+    LV_UNUSED(layout);
+
+    /*The layout is already created. The cache has taken over its memory.*/
+    bool * added = user_data;
+    *added = true;
+    return true;
+}
+
+static void text_layout_free_cb(lv_text_layout_t * layout, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_free((void *)layout->text);
+    lv_free(layout->lines);
+}
+
+static lv_cache_compare_res_t text_layout_compare_cb(const lv_text_layout_t * lhs, const lv_text_layout_t * rhs)
+{
+    if(lhs->hash != rhs->hash) {
+        return lhs->hash > rhs->hash ? 1 : -1;
+    }
+    if(lhs->font != rhs->font) {
+        return lhs->font > rhs->font ? 1 : -1;
+    }
+    if(lhs->max_width != rhs->max_width) {
+        return lhs->max_width > rhs->max_width ? 1 : -1;
+    }
+    if(lhs->letter_space != rhs->letter_space) {
+        return lhs->letter_space > rhs->letter_space ? 1 : -1;
+    }
+    if(lhs->flag != rhs->flag) {
+        return lhs->flag > rhs->flag ? 1 : -1;
+    }
+
+    int32_t cmp_res = lv_strcmp(lhs->text, rhs->text);
+    if(cmp_res != 0) {
+        return cmp_res > 0 ? 1 : -1;
+    }
+    return 0;
+}
+
 #if LV_TXT_ENC == LV_TXT_ENC_UTF8
 /*******************************
  *   UTF-8 ENCODER/DECODER
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_text.h"
+#include "cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -24,6 +25,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t end;           /**< Byte index of the first character of the next line*/
+    int32_t width;          /**< Width of the line as returned by `lv_text_get_width()`*/
+} lv_text_layout_line_t;
+
+/** The lines of a text broken with a given font, width and flags. Stored in the text layout cache.*/
+struct lv_text_layout_t {
+    lv_cache_slot_size_t slot;
+
+    uint32_t hash;
+    const char * text;      /**< Copy of the text owned by the cache*/
+    const lv_font_t * font;
+    int32_t letter_space;
+    int32_t max_width;
+    lv_text_flag_t flag;
+
+    uint32_t line_cnt;
+    lv_text_layout_line_t * lines;
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -44,6 +65,52 @@ extern "C" {
 uint32_t lv_text_get_next_line(const char * txt, const lv_font_t * font, int32_t letter_space,
                                int32_t max_width, int32_t * used_width, lv_text_flag_t flag);
 
+/**
+ * Initialize the text layout cache.
+ * @param size          size of the cache in bytes. 0: disable the cache
+ */
+void lv_text_layout_cache_init(uint32_t size);
+
+/**
+ * Deinitialize the text layout cache and free the cached layouts.
+ */
+void lv_text_layout_cache_deinit(void);
+
+/**
+ * Drop all layouts from the text layout cache.
+ * Needs to be called before a font whose layouts might be cached is deleted.
+ */
+void lv_text_layout_cache_drop(void);
+
+/**
+ * Get the line breaks and line widths of a text from the text layout cache.
+ * If the text is not cached yet it will be broken into lines and added to the cache.
+ * The parameters are interpreted as in `lv_text_get_next_line()`.
+ * @param text          a '\0' terminated string
+ * @param font          pointer to a font
+ * @param letter_space  letter space
+ * @param max_width     max width of the text
+ * @param flag          settings for the text from 'txt_flag_type' enum
+ * @return              the layout of the text or NULL if the cache is disabled or the layout doesn't fit into it.
+ *                      Needs to be released with `lv_text_layout_release()`.
+ */
+lv_text_layout_t * lv_text_layout_acquire(const char * text, const lv_font_t * font, int32_t letter_space,
+                                          int32_t max_width, lv_text_flag_t flag);
+
+/**
+ * Release a layout acquired by `lv_text_layout_acquire()`.
+ * @param layout        pointer to a layout
+ */
+void lv_text_layout_release(lv_text_layout_t * layout);
+
+/**
+ * Get the line which starts at a given byte index.
+ * @param layout        pointer to a layout
+ * @param line_start    byte index of the first character of a line
+ * @return              the line or NULL if `line_start` is at the end of the text
+ */
+const lv_text_layout_line_t * lv_text_layout_get_line(const lv_text_layout_t * layout, uint32_t line_start);
+
 /**
  * Insert a string into another
  * @param txt_buf the original text (must be big enough for the result text and NULL terminated)
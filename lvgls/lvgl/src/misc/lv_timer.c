@@ -12,6 +12,7 @@
 #include "../stdlib/lv_sprintf.h"
 #include "lv_assert.h"
 #include "lv_ll.h"
+#include "lv_math.h"
 #include "lv_profiler.h"
 
 /*********************
@@ -34,6 +35,13 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+static uint32_t collect_ready_timers(void);
+static void collect_ready_timers_core(uint32_t index, uint32_t now, uint32_t * cnt);
+static void timer_update_next_run(lv_timer_t * timer);
+static bool heap_reserve(uint32_t cnt);
+static void heap_insert(lv_timer_t * timer);
+static void heap_remove(lv_timer_t * timer);
+static void heap_sift(lv_timer_t * timer);
 
 /**********************
  *  STATIC VARIABLES
@@ -90,42 +98,31 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
-    /*Run all timer from the list*/
-    lv_timer_t * next;
-    lv_timer_t * timer_active;
-    lv_ll_t * timer_head = timer_ll_p;
+    /*Run the ready timers. Only the timers at the top of the heap are checked
+     *but they are run in the order of the timer list.*/
+    uint32_t ready_cnt;
+    uint32_t i;
     do {
         state_p->timer_deleted             = false;
         state_p->timer_created             = false;
 
-        timer_active = lv_ll_get_head(timer_head);
-        while(timer_active) {
-            /*The timer might be deleted if it runs only once ('repeat_count = 1')
-             *So get next element until the current is surely valid*/
-            next = lv_ll_get_next(timer_head, timer_active);
-
-            if(lv_timer_exec(timer_active)) {
-                /*If a timer was created or deleted then this or the next item might be corrupted*/
+        ready_cnt = collect_ready_timers();
+        for(i = 0; i < ready_cnt; i++) {
+            if(lv_timer_exec(state_p->ready[i])) {
+                /*If a timer was created or deleted then the collected timers might be corrupted*/
                 if(state_p->timer_created || state_p->timer_deleted) {
-                    LV_TRACE_TIMER("Start from the first timer again because a timer was created or deleted");
+                    LV_TRACE_TIMER("Collect the ready timers again because a timer was created or deleted");
                     break;
                 }
             }
-
-            timer_active = next; /*Load the next timer*/
         }
-    } while(timer_active);
+    } while(i < ready_cnt);
 
+    /*The timer which needs to run first is at the top of the heap*/
     uint32_t time_until_next = LV_NO_TIMER_READY;
-    next = lv_ll_get_head(timer_head);
-    while(next) {
-        if(!next->paused) {
-            uint32_t delay = lv_timer_time_remaining(next);
-            if(delay < time_until_next)
-                time_until_next = delay;
-        }
-
-        next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
+    if(state_p->heap_cnt > 0) {
+        int32_t delay = (int32_t)(state_p->heap[0]->next_run - lv_tick_get());
+        time_until_next = delay > 0 ? (uint32_t)delay : 0;
     }
 
     state_p->busy_time += lv_tick_elaps(handler_start);
@@ -167,6 +164,11 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+    if(!heap_reserve(state.timer_cnt + 1)) {
+        LV_LOG_WARN("Couldn't allocate the timer heap");
+        return NULL;
+    }
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -178,6 +180,10 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->last_run = lv_tick_get();
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
+    new_timer->create_id = state.create_cnt++;
+
+    state.timer_cnt++;
+    heap_insert(new_timer);
 
     state.timer_created = true;
 
@@ -194,6 +200,9 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+    if(!timer->paused) heap_remove(timer);
+    state.timer_cnt--;
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,13 +212,19 @@ void lv_timer_delete(lv_timer_t * timer)
 void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
+    if(timer->paused) return;
+
+    heap_remove(timer);
     timer->paused = true;
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
-    timer->paused = false;
+    if(timer->paused) {
+        timer->paused = false;
+        heap_insert(timer);
+    }
     lv_timer_handler_resume();
 }
 
@@ -217,18 +232,26 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+    timer_update_next_run(timer);
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+    timer_update_next_run(timer);
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
 {
     LV_ASSERT_NULL(timer);
     timer->repeat_count = repeat_count;
+
+    /*The handler deletes or pauses the timers with zero repeat count, so let it check this timer soon*/
+    if(repeat_count == 0 && !timer->paused) {
+        timer->next_run = lv_tick_get();
+        heap_sift(timer);
+    }
 }
 
 void lv_timer_set_auto_delete(lv_timer_t * timer, bool auto_delete)
@@ -247,6 +270,7 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+    timer_update_next_run(timer);
     lv_timer_handler_resume();
 }
 
@@ -261,6 +285,14 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+    lv_free(state.heap);
+    lv_free(state.ready);
+    state.heap = NULL;
+    state.ready = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+    state.timer_cnt = 0;
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -349,6 +381,11 @@ static bool lv_timer_exec(lv_timer_t * timer)
         }
     }
 
+    /*Reposition the timer in the heap according to its new (or not yet reached) run time*/
+    if(state.timer_deleted == false && !timer->paused) {
+        timer_update_next_run(timer);
+    }
+
     return exec;
 }
 
@@ -366,6 +403,149 @@ static uint32_t lv_timer_time_remaining(lv_timer_t * timer)
     return timer->period - elp;
 }
 
+/**
+ * Collect the timers which might be ready to run into `state.ready`.
+ * They are sorted by creation in descending order which is the order of the timer list.
+ * @return the number of collected timers
+ */
+static uint32_t collect_ready_timers(void)
+{
+    uint32_t cnt = 0;
+    if(state.heap_cnt > 0) collect_ready_timers_core(0, lv_tick_get(), &cnt);
+
+    /*Insertion sort as usually only a few timers are ready at once*/
+    lv_timer_t ** ready = state.ready;
+    uint32_t i;
+    for(i = 1; i < cnt; i++) {
+        lv_timer_t * timer = ready[i];
+        uint32_t j = i;
+        while(j > 0 && (int32_t)(ready[j - 1]->create_id - timer->create_id) < 0) {
+            ready[j] = ready[j - 1];
+            j--;
+        }
+        ready[j] = timer;
+    }
+
+    return cnt;
+}
+
+/**
+ * Add the timer at `index` and its children to `state.ready` if their run time is reached.
+ * The children can't be ready if their parent is not, so these subtrees are skipped.
+ * @param index     index of a timer in the heap
+ * @param now       the current tick
+ * @param cnt       number of the already collected timers. Incremented with the new ones.
+ */
+static void collect_ready_timers_core(uint32_t index, uint32_t now, uint32_t * cnt)
+{
+    lv_timer_t * timer = state.heap[index];
+    if((int32_t)(timer->next_run - now) > 0) return;
+
+    state.ready[*cnt] = timer;
+    (*cnt)++;
+
+    uint32_t child = index * 2 + 1;
+    if(child < state.heap_cnt) collect_ready_timers_core(child, now, cnt);
+    if(child + 1 < state.heap_cnt) collect_ready_timers_core(child + 1, now, cnt);
+}
+
+/**
+ * Update `next_run` of a timer from its last run and period and move it to its place in the heap.
+ * @param timer pointer to lv_timer
+ */
+static void timer_update_next_run(lv_timer_t * timer)
+{
+    if(timer->paused) return;
+
+    /*Limit it to keep the run times comparable as signed differences.
+     *With longer periods the timer is just checked once more.*/
+    uint32_t remaining = LV_MIN(lv_timer_time_remaining(timer), (uint32_t)INT32_MAX);
+    timer->next_run = lv_tick_get() + remaining;
+    heap_sift(timer);
+}
+
+/**
+ * Make sure the heap and the ready timer buffer can store a given number of timers.
+ * @param cnt   number of timers
+ * @return      true: success, false: out of memory
+ */
+static bool heap_reserve(uint32_t cnt)
+{
+    if(cnt <= state.heap_size) return true;
+
+    uint32_t new_size = state.heap_size ? state.heap_size * 2 : 8;
+    while(new_size < cnt) new_size *= 2;
+
+    lv_timer_t ** heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+    if(heap == NULL) return false;
+    state.heap = heap;
+
+    lv_timer_t ** ready = lv_realloc(state.ready, new_size * sizeof(lv_timer_t *));
+    if(ready == NULL) return false;
+    state.ready = ready;
+
+    state.heap_size = new_size;
+    return true;
+}
+
+static void heap_insert(lv_timer_t * timer)
+{
+    LV_ASSERT(state.heap_cnt < state.heap_size);
+
+    timer->heap_index = state.heap_cnt;
+    state.heap[state.heap_cnt] = timer;
+    state.heap_cnt++;
+
+    timer_update_next_run(timer);
+}
+
+static void heap_remove(lv_timer_t * timer)
+{
+    uint32_t index = timer->heap_index;
+    state.heap_cnt--;
+    if(index == state.heap_cnt) return;
+
+    /*Move the last timer to the free place*/
+    lv_timer_t * last = state.heap[state.heap_cnt];
+    state.heap[index] = last;
+    last->heap_index = index;
+    heap_sift(last);
+}
+
+/**
+ * Move a timer up or down in the heap until its parent runs earlier and its children later.
+ * @param timer pointer to lv_timer
+ */
+static void heap_sift(lv_timer_t * timer)
+{
+    lv_timer_t ** heap = state.heap;
+    uint32_t index = timer->heap_index;
+
+    while(index > 0) {
+        uint32_t parent = (index - 1) / 2;
+        if((int32_t)(heap[parent]->next_run - timer->next_run) <= 0) break;
+
+        heap[index] = heap[parent];
+        heap[index]->heap_index = index;
+        index = parent;
+    }
+
+    while(1) {
+        uint32_t child = index * 2 + 1;
+        if(child >= state.heap_cnt) break;
+
+        if(child + 1 < state.heap_cnt && (int32_t)(heap[child + 1]->next_run - heap[child]->next_run) < 0) child++;
+        if((int32_t)(heap[child]->next_run - timer->next_run) >= 0) break;
+
+        heap[index] = heap[child];
+        heap[index]->heap_index = index;
+        index = child;
+    }
+
+    heap[index] = timer;
+    timer->heap_index = index;
+}
+
 /**
  * Call the ready lv_timer
  */
@@ -33,12 +33,21 @@ struct lv_timer_t {
     lv_timer_cb_t timer_cb;    /**< Timer function */
     void * user_data;          /**< Custom user data */
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
+    uint32_t next_run;         /**< Tick when the timer needs to be checked again. Key in the timer heap*/
+    uint32_t heap_index;       /**< Index in the timer heap (only if not paused)*/
+    uint32_t create_id;        /**< Order of creation to run the ready timers in the order of `timer_ll`*/
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
 };
 
 typedef struct {
     lv_ll_t timer_ll;          /**< Linked list to store the lv_timers */
+    lv_timer_t ** heap;        /**< Min-heap of the not paused timers ordered by `next_run`*/
+    lv_timer_t ** ready;       /**< Buffer to collect the ready timers in `lv_timer_handler()`*/
+    uint32_t heap_cnt;         /**< Number of timers in `heap`*/
+    uint32_t heap_size;        /**< Number of allocated elements in `heap` and `ready`. At least `timer_cnt`*/
+    uint32_t timer_cnt;        /**< Number of timers including the paused ones*/
+    uint32_t create_cnt;       /**< Incremented for every new timer to set `lv_timer_t::create_id`*/
 
     bool lv_timer_run;
     uint8_t idle_last;
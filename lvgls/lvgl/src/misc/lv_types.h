@@ -129,6 +129,8 @@ typedef struct lv_profiler_builtin_config_t lv_profiler_builtin_config_t;
 
 typedef struct lv_rb_node_t lv_rb_node_t;
 
+typedef struct lv_mem_arena_t lv_mem_arena_t;
+
 typedef struct lv_rb_t lv_rb_t;
 
 typedef struct lv_color_filter_dsc_t lv_color_filter_dsc_t;
@@ -145,6 +147,8 @@ typedef struct lv_image_cache_data_t lv_image_cache_data_t;
 
 typedef struct lv_image_header_cache_data_t lv_image_header_cache_data_t;
 
+typedef struct lv_text_layout_t lv_text_layout_t;
+
 typedef struct lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct lv_grad_t lv_grad_t;
@@ -161,6 +165,8 @@ typedef struct lv_obj_style_t lv_obj_style_t;
 
 typedef struct lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct lv_obj_style_res_cache_entry_t lv_obj_style_res_cache_entry_t;
+
 typedef struct lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct lv_cover_check_info_t lv_cover_check_info_t;
@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "../../lvgl.h"
+#include "../../misc/lv_text_private.h"
 
 #if LV_USE_IMGFONT
 
@@ -71,6 +72,9 @@ void lv_imgfont_destroy(lv_font_t * font)
 {
     LV_ASSERT_NULL(font);
 
+    /*The text layouts are cached by the font's address which might be reused by a new font*/
+    lv_text_layout_cache_drop();
+
     imgfont_dsc_t * dsc = (imgfont_dsc_t *)font->dsc;
     lv_free(dsc);
 }
@@ -17,6 +17,7 @@
 #include "../../stdlib/lv_string.h"
 #include "../../widgets/label/lv_label.h"
 #include "../../display/lv_display_private.h"
+#include "../../font/lv_font_glyph_cache.h"
 
 /*********************
  *      DEFINES
@@ -258,6 +259,15 @@ static void perf_update_timer_cb(lv_timer_t * t)
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
 
+    info->calculated.layout_avg_obj_cnt = info->measured.refr_cnt ? (info->measured.layout_obj_cnt /
+                                                                     info->measured.refr_cnt) : 0;
+
+    uint32_t glyph_cache_hit;
+    uint32_t glyph_cache_miss;
+    lv_font_glyph_cache_get_stat(&glyph_cache_hit, &glyph_cache_miss);
+    info->calculated.glyph_cache_hit = glyph_cache_hit - info->measured.glyph_cache_hit_start;
+    info->calculated.glyph_cache_miss = glyph_cache_miss - info->measured.glyph_cache_miss_start;
+
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
@@ -271,6 +281,8 @@ static void perf_update_timer_cb(lv_timer_t * t)
     info->calculated.cpu_avg_total = prev_info.calculated.cpu_avg_total;
     info->calculated.fps_avg_total = prev_info.calculated.fps_avg_total;
     info->calculated.run_cnt = prev_info.calculated.run_cnt;
+    info->measured.glyph_cache_hit_start = glyph_cache_hit;
+    info->measured.glyph_cache_miss_start = glyph_cache_miss;
 
     info->measured.last_report_timestamp = lv_tick_get();
 }
@@ -284,9 +296,12 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
            "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
+           "layout %" LV_PRIu32 " obj/refr, "
+           "glyph cache %" LV_PRIu32 " hit / %" LV_PRIu32 " miss, "
            "CPU %" LV_PRIu32 "%%\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
+           perf->calculated.layout_avg_obj_cnt, perf->calculated.glyph_cache_hit, perf->calculated.glyph_cache_miss,
            perf->calculated.cpu);
 #else
     lv_obj_t * label = lv_observer_get_target(observer);
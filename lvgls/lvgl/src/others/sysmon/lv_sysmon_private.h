@@ -47,6 +47,9 @@ struct lv_sysmon_perf_info_t {
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
         uint32_t last_report_timestamp;
+        uint32_t layout_obj_cnt;    /**< Number of objects whose layout was recalculated*/
+        uint32_t glyph_cache_hit_start;     /**< Glyph cache hits at the last report*/
+        uint32_t glyph_cache_miss_start;    /**< Glyph cache misses at the last report*/
         uint32_t render_in_progress : 1;
     } measured;
 
@@ -56,6 +59,9 @@ struct lv_sysmon_perf_info_t {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t layout_avg_obj_cnt;    /**< Average number of objects re-laid out per refresh*/
+        uint32_t glyph_cache_hit;       /**< Glyphs drawn from the glyph cache since the last report*/
+        uint32_t glyph_cache_miss;      /**< Glyphs rendered into the glyph cache since the last report*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
@@ -46,6 +46,19 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+#if LV_USE_MEM_SLAB
+    static bool slab_add_region(void * mem, size_t bytes);
+    static lv_mem_slab_region_t * slab_find_region(const void * p);
+    static size_t slab_chunk_size(const lv_mem_slab_region_t * region, const void * p);
+    static void * slab_alloc(size_t size);
+    static void slab_free(lv_mem_slab_region_t * region, void * p);
+#endif
+#if LV_USE_MEM_ARENA
+    static lv_mem_arena_t * arena_find(const void * p);
+    static void * arena_alloc(size_t size);
+    static void arena_free(lv_mem_arena_t * arena, void * p);
+    static void arena_release(lv_mem_arena_t * arena);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -93,6 +106,17 @@ void lv_mem_init(void)
     LV_ASSERT_MALLOC(pool_p);
     *pool_p = lv_tlsf_get_pool(state.tlsf);
 
+#if LV_USE_MEM_SLAB && LV_MEM_SLAB_SIZE
+    /*Take the default slab region from the heap*/
+    void * slab_mem = lv_tlsf_malloc(state.tlsf, LV_MEM_SLAB_SIZE);
+    LV_ASSERT_MALLOC(slab_mem);
+    if(slab_mem) {
+        state.cur_used += lv_tlsf_block_size(slab_mem);
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+        slab_add_region(slab_mem, LV_MEM_SLAB_SIZE);
+    }
+#endif
+
 #if LV_MEM_ADD_JUNK
     LV_LOG_WARN("LV_MEM_ADD_JUNK is enabled which makes LVGL much slower");
 #endif
@@ -102,6 +126,13 @@ void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
     lv_tlsf_destroy(state.tlsf);
+#if LV_USE_MEM_SLAB
+    lv_memzero(&state.slab, sizeof(state.slab));
+#endif
+#if LV_USE_MEM_ARENA
+    state.arena_act = NULL;
+    state.arena_list = NULL;
+#endif
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
 #endif
@@ -136,16 +167,110 @@ void lv_mem_remove_pool(lv_mem_pool_t pool)
     LV_LOG_WARN("invalid pool: %p", pool);
 }
 
-void * lv_malloc_core(size_t size)
+#if LV_USE_MEM_SLAB
+lv_result_t lv_mem_add_slab_pool(void * mem, size_t bytes)
 {
+    LV_ASSERT_NULL(mem);
+
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
+    bool res = slab_add_region(mem, bytes);
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    if(!res) {
+        LV_LOG_WARN("failed to add slab pool, address: %p, size: %zu", mem, bytes);
+        return LV_RESULT_INVALID;
+    }
+
+    return LV_RESULT_OK;
+}
+#endif
+
+#if LV_USE_MEM_ARENA
+lv_mem_arena_t * lv_mem_arena_begin(size_t size)
+{
+    size_t header_size = LV_ROUND_UP(sizeof(lv_mem_arena_t), sizeof(MEM_UNIT));
 
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    /*Always allocate from TLSF, not from the currently active arena*/
+    lv_mem_arena_t * arena = lv_tlsf_malloc(state.tlsf, header_size + size);
+    if(arena) {
+        state.cur_used += lv_tlsf_block_size(arena);
         state.max_used = LV_MAX(state.cur_used, state.max_used);
+
+        arena->top = (uint8_t *)arena + header_size;
+        arena->end = arena->top + size;
+        arena->live_cnt = 0;
+        arena->ended = false;
+
+        arena->next = state.arena_list;
+        state.arena_list = arena;
+        arena->prev_active = state.arena_act;
+        state.arena_act = arena;
+    }
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    if(arena == NULL) LV_LOG_WARN("couldn't allocate the arena (%zu bytes)", size);
+
+    return arena;
+}
+
+void lv_mem_arena_end(lv_mem_arena_t * arena)
+{
+    LV_ASSERT_NULL(arena);
+
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    LV_ASSERT_MSG(arena == state.arena_act, "Not the latest active arena");
+    state.arena_act = arena->prev_active;
+    arena->ended = true;
+
+    bool release = arena->live_cnt == 0;
+    if(release) arena_release(arena);
+#if LV_USE_OS
+    lv_mutex_unlock(&state.mutex);
+#endif
+
+    if(release) lv_free_core(arena);
+}
+
+size_t lv_mem_arena_get_used(const lv_mem_arena_t * arena)
+{
+    LV_ASSERT_NULL(arena);
+
+    size_t header_size = LV_ROUND_UP(sizeof(lv_mem_arena_t), sizeof(MEM_UNIT));
+    return arena->top - ((const uint8_t *)arena + header_size);
+}
+#endif
+
+void * lv_malloc_core(size_t size)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&state.mutex);
+#endif
+    void * p = NULL;
+#if LV_USE_MEM_ARENA
+    p = arena_alloc(size);
+#endif
+#if LV_USE_MEM_SLAB
+    if(p == NULL) p = slab_alloc(size);
+#endif
+
+    if(p == NULL) {
+        p = lv_tlsf_malloc(state.tlsf, size);
+
+        if(p) {
+            state.cur_used += lv_tlsf_block_size(p);
+            state.max_used = LV_MAX(state.cur_used, state.max_used);
+        }
     }
 
 #if LV_USE_OS
@@ -160,6 +285,56 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_USE_MEM_ARENA
+    lv_mem_arena_t * arena = arena_find(p);
+    if(arena) {
+        MEM_UNIT * header = (MEM_UNIT *)p - 1;
+        size_t old_size = *header;
+        /*The last allocation of the active arena can grow in place*/
+        if(arena == state.arena_act && (uint8_t *)p + old_size == arena->top) {
+            size_t new_size_round = LV_ROUND_UP(new_size, sizeof(MEM_UNIT));
+            if((uint8_t *)p + new_size_round <= arena->end) {
+                arena->top = (uint8_t *)p + new_size_round;
+                *header = new_size_round;
+#if LV_USE_OS
+                lv_mutex_unlock(&state.mutex);
+#endif
+                return p;
+            }
+        }
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        if(new_size <= old_size) return p;
+
+        void * p_new = lv_malloc_core(new_size);
+        if(p_new) {
+            lv_memcpy(p_new, p, old_size);
+            lv_free_core(p);
+        }
+        return p_new;
+    }
+#endif
+
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_region_t * region = slab_find_region(p);
+    if(region) {
+        size_t chunk_size = slab_chunk_size(region, p);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        /*It still fits into the chunk*/
+        if(new_size <= chunk_size) return p;
+
+        void * p_new = lv_malloc_core(new_size);
+        if(p_new) {
+            lv_memcpy(p_new, p, chunk_size);
+            lv_free_core(p);
+        }
+        return p_new;
+    }
+#endif
+
     size_t old_size = lv_tlsf_block_size(p);
     void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
 
@@ -181,6 +356,32 @@ void lv_free_core(void * p)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_USE_MEM_ARENA
+    lv_mem_arena_t * arena = arena_find(p);
+    if(arena) {
+        arena_free(arena, p);
+        bool release = arena->ended && arena->live_cnt == 0;
+        if(release) arena_release(arena);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        /*Return the whole arena to the heap*/
+        if(release) lv_free_core(arena);
+        return;
+    }
+#endif
+
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_region_t * region = slab_find_region(p);
+    if(region) {
+        slab_free(region, p);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return;
+    }
+#endif
+
 #if LV_MEM_ADD_JUNK
     lv_memset(p, 0xbb, lv_tlsf_block_size(data));
 #endif
@@ -216,6 +417,13 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
 
     mon_p->max_used = state.max_used;
 
+#if LV_USE_MEM_SLAB
+    mon_p->slab_size = state.slab.total_size;
+    mon_p->slab_free_size = state.slab.total_size - state.slab.used_size;
+    mon_p->slab_class_free_size = state.slab.assigned_size - state.slab.used_size;
+    mon_p->slab_miss_cnt = state.slab.miss_cnt;
+#endif
+
     LV_TRACE_MEM("finished");
 }
 
@@ -270,4 +478,154 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+#if LV_USE_MEM_SLAB
+
+static bool slab_add_region(void * mem, size_t bytes)
+{
+    /*Align the start and reserve room for the header, the page classes and the alignment of the pages*/
+    uint8_t * start = (uint8_t *)LV_ROUND_UP((lv_uintptr_t)mem, sizeof(void *));
+    size_t header_size = (start - (uint8_t *)mem) + sizeof(lv_mem_slab_region_t) + sizeof(void *);
+    if(bytes <= header_size) return false;
+
+    uint32_t page_cnt = (bytes - header_size) / (LV_MEM_SLAB_PAGE_SIZE + 1);
+    if(page_cnt == 0) return false;
+
+    lv_mem_slab_region_t * region = (lv_mem_slab_region_t *)start;
+    region->page_cnt = page_cnt;
+    region->page_used = 0;
+    region->pages = (uint8_t *)LV_ROUND_UP((lv_uintptr_t)&region->page_class[page_cnt], sizeof(void *));
+    region->pages_end = region->pages + page_cnt * LV_MEM_SLAB_PAGE_SIZE;
+
+    /*The latest region (probably a faster RAM) is used first*/
+    region->next = state.slab.regions;
+    state.slab.regions = region;
+    state.slab.total_size += page_cnt * LV_MEM_SLAB_PAGE_SIZE;
+
+    return true;
+}
+
+static lv_mem_slab_region_t * slab_find_region(const void * p)
+{
+    lv_mem_slab_region_t * region;
+    for(region = state.slab.regions; region; region = region->next) {
+        if((const uint8_t *)p >= region->pages && (const uint8_t *)p < region->pages_end) return region;
+    }
+
+    return NULL;
+}
+
+static size_t slab_chunk_size(const lv_mem_slab_region_t * region, const void * p)
+{
+    uint32_t page = ((const uint8_t *)p - region->pages) / LV_MEM_SLAB_PAGE_SIZE;
+    return (region->page_class[page] + 1) * LV_MEM_SLAB_STEP;
+}
+
+static void * slab_alloc(size_t size)
+{
+    if(size > LV_MEM_SLAB_MAX || state.slab.regions == NULL) return NULL;
+
+    uint32_t cls = (size - 1) / LV_MEM_SLAB_STEP;
+    uint32_t chunk_size = (cls + 1) * LV_MEM_SLAB_STEP;
+
+    if(state.slab.free_list[cls] == NULL) {
+        /*Cut a new page to chunks*/
+        lv_mem_slab_region_t * region;
+        for(region = state.slab.regions; region; region = region->next) {
+            if(region->page_used < region->page_cnt) break;
+        }
+
+        if(region == NULL) {
+            state.slab.miss_cnt++;
+            return NULL;
+        }
+
+        region->page_class[region->page_used] = cls;
+        uint8_t * page = region->pages + region->page_used * LV_MEM_SLAB_PAGE_SIZE;
+        region->page_used++;
+        state.slab.assigned_size += LV_MEM_SLAB_PAGE_SIZE;
+
+        uint32_t chunk_cnt = LV_MEM_SLAB_PAGE_SIZE / chunk_size;
+        uint32_t i;
+        for(i = chunk_cnt; i > 0; i--) {
+            lv_mem_slab_chunk_t * chunk = (lv_mem_slab_chunk_t *)(page + (i - 1) * chunk_size);
+            chunk->next = state.slab.free_list[cls];
+            state.slab.free_list[cls] = chunk;
+        }
+    }
+
+    lv_mem_slab_chunk_t * chunk = state.slab.free_list[cls];
+    state.slab.free_list[cls] = chunk->next;
+    state.slab.used_size += chunk_size;
+
+    return chunk;
+}
+
+static void slab_free(lv_mem_slab_region_t * region, void * p)
+{
+    size_t chunk_size = slab_chunk_size(region, p);
+    uint32_t cls = chunk_size / LV_MEM_SLAB_STEP - 1;
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, chunk_size);
+#endif
+
+    lv_mem_slab_chunk_t * chunk = p;
+    chunk->next = state.slab.free_list[cls];
+    state.slab.free_list[cls] = chunk;
+    state.slab.used_size -= chunk_size;
+}
+
+#endif /*LV_USE_MEM_SLAB*/
+
+#if LV_USE_MEM_ARENA
+
+static lv_mem_arena_t * arena_find(const void * p)
+{
+    lv_mem_arena_t * arena;
+    for(arena = state.arena_list; arena; arena = arena->next) {
+        if((const uint8_t *)p > (const uint8_t *)arena && (const uint8_t *)p < arena->end) return arena;
+    }
+
+    return NULL;
+}
+
+static void * arena_alloc(size_t size)
+{
+    lv_mem_arena_t * arena = state.arena_act;
+    if(arena == NULL) return NULL;
+
+    /*Store the size before the allocation to support `lv_realloc()`*/
+    size = LV_ROUND_UP(size, sizeof(MEM_UNIT));
+    if(size + sizeof(MEM_UNIT) > (size_t)(arena->end - arena->top)) return NULL;
+
+    MEM_UNIT * header = (MEM_UNIT *)arena->top;
+    *header = size;
+    arena->top += sizeof(MEM_UNIT) + size;
+    arena->live_cnt++;
+
+    return header + 1;
+}
+
+static void arena_free(lv_mem_arena_t * arena, void * p)
+{
+    MEM_UNIT * header = (MEM_UNIT *)p - 1;
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, *header);
+#endif
+
+    /*Roll back the last allocation so that temporary buffers don't waste the arena*/
+    if((uint8_t *)p + *header == arena->top) arena->top = (uint8_t *)header;
+    arena->live_cnt--;
+}
+
+static void arena_release(lv_mem_arena_t * arena)
+{
+    lv_mem_arena_t ** arena_p = &state.arena_list;
+    while(*arena_p != arena) arena_p = &(*arena_p)->next;
+    *arena_p = arena->next;
+}
+
+#endif /*LV_USE_MEM_ARENA*/
 #endif /*LV_STDLIB_BUILTIN*/
@@ -0,0 +1,191 @@
+/**
+ * @file lv_mem_slab_bench.c
+ *
+ * Benchmark of the builtin allocator with object create/delete churn.
+ * It's a standalone program which is compiled only if `LV_MEM_SLAB_BENCH` is defined.
+ *
+ * Build it on a host with `LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN`. From the folder of `lv_conf.h`:
+ *
+ *     gcc -O2 -I. -Ilvgl -DLV_CONF_INCLUDE_SIMPLE -DLV_MEM_SLAB_BENCH \
+ *         $(find lvgl/src -name "*.c") -lm -lpthread -o mem_bench
+ *
+ * Usage: `./mem_bench [round_cnt] [slab_pool_kb]`
+ *
+ * In every round a part of the containers (each with labels, local styles and an event) is deleted
+ * and recreated in a random order to mix short and long living small allocations.
+ * The time of the rounds and the statistics of `lv_mem_monitor()` are printed.
+ * Build it again with `LV_USE_MEM_SLAB 0` to compare the speed and the fragmentation without the slab.
+ * With `slab_pool_kb` an extra slab region is added with `lv_mem_add_slab_pool()`.
+ * 4 MB is added to the heap in `LV_MEM_SIZE` sized pools. The fragmentation is calculated from the
+ * biggest free block of any pool so set a larger `LV_MEM_SIZE` (e.g. 4 MB) to see it clearly.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#ifdef LV_MEM_SLAB_BENCH
+
+#include "../../../lvgl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/*********************
+ *      DEFINES
+ *********************/
+#define HOR_RES         320
+#define VER_RES         240
+#define CONT_CNT        300
+#define LABEL_CNT       8
+#define CHURN_CNT       100         /*Containers recreated in every round*/
+#define POOL_CNT        ((4 * 1024 * 1024) / LV_MEM_SIZE)    /*A pool can't be larger than LV_MEM_SIZE*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_obj_t * cont_create(lv_obj_t * parent, uint32_t id);
+static void dummy_event_cb(lv_event_t * e);
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
+static uint32_t tick_get_cb(void);
+static void print_monitor(const char * title);
+static double now_ms(void);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+static uint8_t pools[POOL_CNT][LV_MEM_SIZE];
+static uint8_t draw_buf[HOR_RES * 10 * 2];
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+int main(int argc, char ** argv)
+{
+    uint32_t round_cnt = argc > 1 ? atoi(argv[1]) : 200;
+    uint32_t slab_pool_kb = argc > 2 ? atoi(argv[2]) : 0;
+
+    lv_init();
+
+    uint32_t i;
+    for(i = 0; i < POOL_CNT; i++) lv_mem_add_pool(pools[i], LV_MEM_SIZE);
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_SLAB
+    if(slab_pool_kb) {
+        void * slab_pool = malloc(slab_pool_kb * 1024);
+        if(lv_mem_add_slab_pool(slab_pool, slab_pool_kb * 1024) != LV_RESULT_OK) {
+            printf("Couldn't add the slab pool\n");
+        }
+    }
+#else
+    if(slab_pool_kb) printf("The slab is disabled, the slab pool is ignored\n");
+#endif
+
+    lv_tick_set_cb(tick_get_cb);
+    lv_display_t * disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    lv_obj_t * scr = lv_screen_active();
+    print_monitor("empty screen");
+
+    srand(1);
+    double t_start = now_ms();
+    for(i = 0; i < CONT_CNT; i++) cont_create(scr, i);
+    double t_create = now_ms() - t_start;
+    print_monitor("created");
+
+    t_start = now_ms();
+    uint32_t r;
+    for(r = 0; r < round_cnt; r++) {
+        uint32_t k;
+        for(k = 0; k < CHURN_CNT; k++) {
+            uint32_t idx = rand() % lv_obj_get_child_count(scr);
+            lv_obj_delete(lv_obj_get_child(scr, idx));
+        }
+        for(k = 0; k < CHURN_CNT; k++) {
+            lv_obj_t * cont = cont_create(scr, rand());
+            lv_obj_move_to_index(cont, rand() % lv_obj_get_child_count(scr));
+        }
+    }
+    double t_churn = now_ms() - t_start;
+    print_monitor("after churn");
+
+    t_start = now_ms();
+    lv_obj_clean(scr);
+    double t_delete = now_ms() - t_start;
+    print_monitor("cleaned");
+
+    printf("create: %.3f ms/container, churn: %.3f ms/round, delete all: %.3f ms\n",
+           t_create / CONT_CNT, t_churn / round_cnt, t_delete);
+
+    return 0;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_obj_t * cont_create(lv_obj_t * parent, uint32_t id)
+{
+    lv_obj_t * cont = lv_obj_create(parent);
+    lv_obj_set_size(cont, 100, 60);
+    lv_obj_set_style_bg_color(cont, lv_color_hex(id * 0x1234), 0);
+    lv_obj_add_event_cb(cont, dummy_event_cb, LV_EVENT_CLICKED, NULL);
+
+    uint32_t i;
+    for(i = 0; i < LABEL_CNT; i++) {
+        lv_obj_t * label = lv_label_create(cont);
+        lv_label_set_text_fmt(label, "Item %"LV_PRIu32".%"LV_PRIu32, id, i);
+        if(i % 2) lv_obj_set_style_text_color(label, lv_color_hex(0xff0000), 0);
+    }
+
+    return cont;
+}
+
+static void dummy_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+}
+
+static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static uint32_t tick_get_cb(void)
+{
+    return (uint32_t)now_ms();
+}
+
+static void print_monitor(const char * title)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    printf("%-14s used: %7zu  biggest free: %7zu  frag: %3d %%", title, mon.total_size - mon.free_size,
+           mon.free_biggest_size, mon.frag_pct);
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_SLAB
+    printf("  slab: %zu, free: %zu, bound free: %zu, miss: %"LV_PRIu32, mon.slab_size, mon.slab_free_size,
+           mon.slab_class_free_size, mon.slab_miss_cnt);
+#endif
+    printf("\n");
+}
+
+static double now_ms(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1e3 + t.tv_nsec / 1e6;
+}
+
+#endif /*LV_MEM_SLAB_BENCH*/
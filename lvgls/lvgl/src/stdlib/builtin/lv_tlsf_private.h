@@ -22,10 +22,59 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_MEM_SLAB
+/*The slab serves the sizes up to LV_MEM_SLAB_MAX in LV_MEM_SLAB_STEP steps*/
+#define LV_MEM_SLAB_STEP        8
+#define LV_MEM_SLAB_MAX         64
+#define LV_MEM_SLAB_CLASS_CNT   (LV_MEM_SLAB_MAX / LV_MEM_SLAB_STEP)
+/*The regions are cut to pages and each page is assigned to a size class on demand*/
+#define LV_MEM_SLAB_PAGE_SIZE   256
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_MEM_SLAB
+typedef struct lv_mem_slab_chunk_t {
+    struct lv_mem_slab_chunk_t * next;
+} lv_mem_slab_chunk_t;
+
+/**
+ * A memory region of the slab. It's followed by the size class of each page
+ * and the pages themselves.
+ */
+typedef struct lv_mem_slab_region_t {
+    struct lv_mem_slab_region_t * next;
+    uint8_t * pages;            /**< Start of the first page*/
+    uint8_t * pages_end;        /**< End of the last page*/
+    uint32_t page_cnt;
+    uint32_t page_used;         /**< Number of pages already assigned to a size class*/
+    uint8_t page_class[];       /**< Size class index of the assigned pages*/
+} lv_mem_slab_region_t;
+
+typedef struct {
+    lv_mem_slab_chunk_t * free_list[LV_MEM_SLAB_CLASS_CNT];
+    lv_mem_slab_region_t * regions;
+    size_t total_size;          /**< Size of all pages*/
+    size_t used_size;           /**< Size of the chunks in use*/
+    size_t assigned_size;       /**< Size of the pages assigned to a size class*/
+    uint32_t miss_cnt;          /**< Small allocations passed to TLSF as the slab was full*/
+} lv_mem_slab_t;
+#endif
+
+#if LV_USE_MEM_ARENA
+struct lv_mem_arena_t {
+    struct lv_mem_arena_t * next;           /**< Next arena which has live allocations*/
+    struct lv_mem_arena_t * prev_active;    /**< The arena which was active before this one*/
+    uint8_t * top;                          /**< Start of the free space*/
+    uint8_t * end;
+    uint32_t live_cnt;                      /**< Number of not freed allocations*/
+    bool ended;
+    uint8_t data[];
+};
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -34,6 +83,13 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_t slab;
+#endif
+#if LV_USE_MEM_ARENA
+    lv_mem_arena_t * arena_act;     /**< The arena serving the allocations*/
+    lv_mem_arena_t * arena_list;    /**< All arenas which are active or have live allocations*/
+#endif
 } lv_tlsf_state_t;
 
 /**********************
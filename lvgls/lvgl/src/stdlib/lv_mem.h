@@ -41,6 +41,10 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+    size_t slab_size;   /**< Total size of the small-object slab (it's counted as used in the heap) */
+    size_t slab_free_size;          /**< Free bytes in the slab */
+    size_t slab_class_free_size;    /**< Free bytes already bound to a size class (can't serve other sizes) */
+    uint32_t slab_miss_cnt;         /**< Small allocations served by the heap as the slab was full */
 } lv_mem_monitor_t;
 
 /**********************
@@ -61,6 +65,48 @@ lv_mem_pool_t lv_mem_add_pool(void * mem, size_t bytes);
 
 void lv_mem_remove_pool(lv_mem_pool_t pool);
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_SLAB
+/**
+ * Add a memory region to the small-object slab. Place it in a faster RAM (e.g. a TCM)
+ * to speed up the access of the small objects.
+ * The region can't be removed later.
+ * @param mem       start address of the region
+ * @param bytes     size of the region in bytes
+ * @return          LV_RESULT_OK on success or LV_RESULT_INVALID if the region is too small
+ */
+lv_result_t lv_mem_add_slab_pool(void * mem, size_t bytes);
+#endif
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_ARENA
+/**
+ * Allocate an arena from the heap and start to serve all `lv_malloc()`s from it.
+ * The allocations are bump-allocated in the arena and `lv_free()` only counts them
+ * (or rolls back the last one). When the arena is ended and all of its allocations are freed
+ * the whole arena is returned to the heap in one step.
+ * If the arena gets full the allocations are served from the heap.
+ * Arenas can be nested.
+ * @param size      size of the arena in bytes
+ * @return          the new arena or NULL if it couldn't be allocated
+ * @note            Create e.g. a whole screen between `lv_mem_arena_begin()` and `lv_mem_arena_end()`.
+ *                  When the screen is deleted the arena is freed too.
+ * @note            All threads allocate from the arena while it's active.
+ */
+lv_mem_arena_t * lv_mem_arena_begin(size_t size);
+
+/**
+ * Stop serving the allocations from an arena. It's freed when its last allocation is freed.
+ * @param arena     the arena returned by `lv_mem_arena_begin()`. It must be the latest active arena.
+ */
+void lv_mem_arena_end(lv_mem_arena_t * arena);
+
+/**
+ * Get the number of bytes bump-allocated in an arena
+ * @param arena     an arena which is still active
+ * @return          the used bytes including the headers of the allocations
+ */
+size_t lv_mem_arena_get_used(const lv_mem_arena_t * arena);
+#endif
+
 /**
  * Allocate memory dynamically
  * @param size requested size in bytes
@@ -698,6 +698,14 @@ static void draw_image(lv_event_t * e)
             return;
         }
 
+#if LV_USE_IMAGE_PREFETCH
+        /*Only the background is drawn until the image is decoded*/
+        if(lv_image_prefetch_is_pending(img->src)) {
+            info->res = LV_COVER_RES_NOT_COVER;
+            return;
+        }
+#endif
+
         /*Non true color format might have "holes"*/
         if(lv_color_format_has_alpha(img->cf)) {
             info->res = LV_COVER_RES_NOT_COVER;
@@ -746,6 +754,10 @@ static void draw_image(lv_event_t * e)
 
         if(img->h == 0 || img->w == 0) return;
         if(img->scale_x == 0 || img->scale_y == 0) return;
+#if LV_USE_IMAGE_PREFETCH
+        /*Don't block the rendering by decoding here. It will be redrawn when the decoding is ready.*/
+        if(lv_image_prefetch_is_pending(img->src)) return;
+#endif
 
         lv_layer_t * layer = lv_event_get_layer(e);
 